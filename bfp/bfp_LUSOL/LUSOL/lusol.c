@@ -39,6 +39,10 @@
                 Also include various bug fixes (disable by undef YZHANG)
                 Yin Zhang <yzhang@cs.utexas.edu>
    01 Jan 2006: Added storage of singular indeces, not only the last.
+   17 Oct 2026: Added optional alignment and huge page advice for the
+                arrays of length lena+1.
+   17 Oct 2026: Optional 64-bit non-zero positions (NZINDEX64) for
+                lena, locc, locr and the luparm counts.
    ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
 
 #include <stdlib.h>
@@ -49,6 +53,9 @@
 #include <math.h>
 #include "lusol.h"
 #include "myblas.h"
+#if defined __linux__
+  #include <sys/mman.h>
+#endif
 #ifdef MATLAB
   #include "mex.h"
 #endif
@@ -59,7 +66,7 @@
 
 /* LUSOL Object creation and destruction */
 
-void *clean_realloc(void *oldptr, int width, int newsize, int oldsize)
+void *clean_realloc(void *oldptr, int width, NZINDEX newsize, NZINDEX oldsize)
 {
   newsize *= width;
   oldsize *= width;
@@ -70,12 +77,48 @@ void *clean_realloc(void *oldptr, int width, int newsize, int oldsize)
   return(oldptr);
 }
 
-MYBOOL LUSOL_realloc_a(LUSOLrec *LUSOL, int newsize)
+/* Variant of clean_realloc for the arrays of length lena+1, which observes the
+   alignment and huge page settings; the block can still be released by free() */
+void *clean_realloc_a(LUSOLrec *LUSOL, void *oldptr, int width, NZINDEX newsize, NZINDEX oldsize)
 {
-  int oldsize;
+#if (defined WIN32) || (defined WIN64) || (defined MATLAB) || (defined NOALIGNEDALLOC)
+  return( clean_realloc(oldptr, width, newsize, oldsize) );
+#else
+  void   *newptr;
+  size_t alignment = LUSOL->memalign;
+  MYBOOL ishuge;
+
+  if((alignment == 0) || (newsize == 0))
+    return( clean_realloc(oldptr, width, newsize, oldsize) );
+  newsize *= width;
+  oldsize *= width;
+  ishuge = (MYBOOL) ((LUSOL->memhugesize > 0) && (newsize >= LUSOL->memhugesize));
+  if(ishuge)
+    alignment = 2097152;
+
+  /* Allocate aligned and move the contents over */
+  if(posix_memalign(&newptr, alignment, newsize) != 0)
+    return( NULL );
+  if(oldptr != NULL) {
+    memcpy(newptr, oldptr, MIN(oldsize, newsize));
+    LUSOL_FREE(oldptr);
+  }
+  if(newsize > oldsize)
+    memset((char *)newptr+oldsize, '\0', newsize-oldsize);
+#if (defined __linux__) && (defined MADV_HUGEPAGE)
+  if(ishuge)
+    madvise(newptr, newsize / alignment * alignment, MADV_HUGEPAGE);
+#endif
+  return( newptr );
+#endif
+}
+
+MYBOOL LUSOL_realloc_a(LUSOLrec *LUSOL, NZINDEX newsize)
+{
+  NZINDEX oldsize;
 
   if(newsize < 0)
-    newsize = LUSOL->lena + MAX(abs(newsize), LUSOL_MINDELTA_a);
+    newsize = LUSOL->lena + MAX(-newsize, LUSOL_MINDELTA_a);
 
   oldsize = LUSOL->lena;
   LUSOL->lena = newsize;
@@ -84,12 +127,12 @@ MYBOOL LUSOL_realloc_a(LUSOLrec *LUSOL, int newsize)
   if(oldsize > 0)
     oldsize++;
 
-  LUSOL->a    = (REAL *) clean_realloc(LUSOL->a,    sizeof(*(LUSOL->a)),
-                                                    newsize, oldsize);
-  LUSOL->indc = (int *)  clean_realloc(LUSOL->indc, sizeof(*(LUSOL->indc)),
-                                                    newsize, oldsize);
-  LUSOL->indr = (int *)  clean_realloc(LUSOL->indr, sizeof(*(LUSOL->indr)),
-                                                    newsize, oldsize);
+  LUSOL->a    = (REAL *) clean_realloc_a(LUSOL, LUSOL->a,    sizeof(*(LUSOL->a)),
+                                                             newsize, oldsize);
+  LUSOL->indc = (int *)  clean_realloc_a(LUSOL, LUSOL->indc, sizeof(*(LUSOL->indc)),
+                                                             newsize, oldsize);
+  LUSOL->indr = (int *)  clean_realloc_a(LUSOL, LUSOL->indr, sizeof(*(LUSOL->indr)),
+                                                             newsize, oldsize);
   if((newsize == 0) ||
      ((LUSOL->a != NULL) && (LUSOL->indc != NULL) && (LUSOL->indr != NULL)))
     return( TRUE );
@@ -97,12 +140,12 @@ MYBOOL LUSOL_realloc_a(LUSOLrec *LUSOL, int newsize)
     return( FALSE );
 }
 
-MYBOOL LUSOL_expand_a(LUSOLrec *LUSOL, int *delta_lena, int *right_shift)
+MYBOOL LUSOL_expand_a(LUSOLrec *LUSOL, NZINDEX *delta_lena, NZINDEX *right_shift)
 {
 #ifdef StaticMemAlloc
   return( FALSE );
 #else
-  int LENA, NFREE, LFREE;
+  NZINDEX LENA, NFREE, LFREE;
 
   /* Add expansion factor to avoid having to resize too often/too much;
      (exponential formula suggested by Michael A. Saunders) */
@@ -154,7 +197,7 @@ MYBOOL LUSOL_realloc_r(LUSOLrec *LUSOL, int newsize)
                                                      newsize, oldsize);
   LUSOL->ipinv = (int *) clean_realloc(LUSOL->ipinv, sizeof(*(LUSOL->ipinv)),
                                                      newsize, oldsize);
-  LUSOL->locr  = (int *) clean_realloc(LUSOL->locr,  sizeof(*(LUSOL->locr)),
+  LUSOL->locr  = (NZINDEX *) clean_realloc(LUSOL->locr,  sizeof(*(LUSOL->locr)),
                                                      newsize, oldsize);
 
   if((newsize == 0) ||
@@ -201,7 +244,7 @@ MYBOOL LUSOL_realloc_c(LUSOLrec *LUSOL, int newsize)
                                                       newsize, oldsize);
   LUSOL->iqinv = (int *)  clean_realloc(LUSOL->iqinv, sizeof(*(LUSOL->iqinv)),
                                                       newsize, oldsize);
-  LUSOL->locc  = (int *)  clean_realloc(LUSOL->locc,  sizeof(*(LUSOL->locc)),
+  LUSOL->locc  = (NZINDEX *) clean_realloc(LUSOL->locc,  sizeof(*(LUSOL->locc)),
                                                       newsize, oldsize);
   LUSOL->w     = (REAL *) clean_realloc(LUSOL->w,     sizeof(*(LUSOL->w)),
                                                       newsize, oldsize);
@@ -285,7 +328,7 @@ LUSOLrec *LUSOL_create(FILE *outstream, int msgfil, int pivotmodel, int updateli
   return( newLU );
 }
 
-MYBOOL LUSOL_sizeto(LUSOLrec *LUSOL, int init_r, int init_c, int init_a)
+MYBOOL LUSOL_sizeto(LUSOLrec *LUSOL, int init_r, int init_c, NZINDEX init_a)
 {
   if(init_c == 0)
     LUSOL_FREE(LUSOL->isingular);
@@ -478,7 +521,7 @@ char *LUSOL_informstr(LUSOLrec *LUSOL, int inform)
 
 void LUSOL_clear(LUSOLrec *LUSOL, MYBOOL nzonly)
 {
-  int len;
+  NZINDEX len;
 
   LUSOL->nelem = 0;
   if(!nzonly) {
@@ -529,9 +572,10 @@ void LUSOL_clear(LUSOLrec *LUSOL, MYBOOL nzonly)
   }
 }
 
-MYBOOL LUSOL_assign(LUSOLrec *LUSOL, int iA[], int jA[], REAL Aij[], int nzcount, MYBOOL istriplet)
+MYBOOL LUSOL_assign(LUSOLrec *LUSOL, int iA[], int jA[], REAL Aij[], NZINDEX nzcount, MYBOOL istriplet)
 {
-  int k, m, n, ij, kol;
+  int     m, n, ij, kol;
+  NZINDEX k;
 
   /* Adjust the size of the a structure */
   if(nzcount > (LUSOL->lena/LUSOL->luparm[LUSOL_IP_SCALAR_NZA]) &&
@@ -580,12 +624,12 @@ MYBOOL LUSOL_assign(LUSOLrec *LUSOL, int iA[], int jA[], REAL Aij[], int nzcount
 
 int LUSOL_loadColumn(LUSOLrec *LUSOL, int iA[], int jA, REAL Aij[], int nzcount, int offset1)
 {
-  int i, ii, nz, k;
+  int     i, ii, k;
+  NZINDEX nz;
 
   nz = LUSOL->nelem;
-  i = nz + nzcount;
-  if(i > (LUSOL->lena/LUSOL->luparm[LUSOL_IP_SCALAR_NZA]) &&
-     !LUSOL_realloc_a(LUSOL, i*LUSOL->luparm[LUSOL_IP_SCALAR_NZA]))
+  if(nz + nzcount > (LUSOL->lena/LUSOL->luparm[LUSOL_IP_SCALAR_NZA]) &&
+     !LUSOL_realloc_a(LUSOL, (nz + nzcount)*LUSOL->luparm[LUSOL_IP_SCALAR_NZA]))
   return( -1 );
 
   k = 0;
@@ -614,6 +658,7 @@ void LUSOL_free(LUSOLrec *LUSOL)
   LUSOL_realloc_a(LUSOL, 0);
   LUSOL_realloc_r(LUSOL, 0);
   LUSOL_realloc_c(LUSOL, 0);
+  LUSOL_FREE(LUSOL->isingular);
   if(LUSOL->L0 != NULL)
     LUSOL_matfree(&(LUSOL->L0));
   if(LUSOL->U != NULL)
@@ -755,17 +800,17 @@ void LUSOL_dump(FILE *output, LUSOLrec *LUSOL)
   if(!userfile)
     output = fopen("LUSOL.dbg", "w");
 
-  blockWriteREAL(output, "a", LUSOL->a, 1, LUSOL->lena);
-  blockWriteINT(output, "indc", LUSOL->indc, 1, LUSOL->lena);
-  blockWriteINT(output, "indr", LUSOL->indr, 1, LUSOL->lena);
+  blockWriteREAL(output, "a", LUSOL->a, 1, (int) LUSOL->lena);
+  blockWriteINT(output, "indc", LUSOL->indc, 1, (int) LUSOL->lena);
+  blockWriteINT(output, "indr", LUSOL->indr, 1, (int) LUSOL->lena);
 
   blockWriteINT(output, "ip", LUSOL->ip, 1, LUSOL->m);
   blockWriteINT(output, "iq", LUSOL->iq, 1, LUSOL->n);
   blockWriteINT(output, "lenc", LUSOL->lenc, 1, LUSOL->n);
   blockWriteINT(output, "lenr", LUSOL->lenr, 1, LUSOL->m);
 
-  blockWriteINT(output, "locc", LUSOL->locc, 1, LUSOL->n);
-  blockWriteINT(output, "locr", LUSOL->locr, 1, LUSOL->m);
+  blockWriteNZINDEX(output, "locc", LUSOL->locc, 1, LUSOL->n);
+  blockWriteNZINDEX(output, "locr", LUSOL->locr, 1, LUSOL->m);
   blockWriteINT(output, "iploc", LUSOL->iploc, 1, LUSOL->n);
   blockWriteINT(output, "iqloc", LUSOL->iqloc, 1, LUSOL->m);
 
@@ -776,14 +821,14 @@ void LUSOL_dump(FILE *output, LUSOLrec *LUSOL)
     fclose(output);
 }
 
-LUSOLmat *LUSOL_matcreate(int dim, int nz)
+LUSOLmat *LUSOL_matcreate(int dim, NZINDEX nz)
 {
   LUSOLmat *newm;
 
   newm = (LUSOLmat *) LUSOL_CALLOC(1, sizeof(*newm));
   if(newm != NULL) {
     newm->a    = (REAL *) LUSOL_MALLOC((nz+1)*sizeof(REAL));
-    newm->lenx = (int *)  LUSOL_MALLOC((dim+1)*sizeof(int));
+    newm->lenx = (NZINDEX *) LUSOL_MALLOC((dim+1)*sizeof(NZINDEX));
     newm->indx = (int *)  LUSOL_MALLOC((dim+1)*sizeof(int));
     newm->indr = (int *)  LUSOL_MALLOC((nz+1)*sizeof(int));
     newm->indc = (int *)  LUSOL_MALLOC((nz+1)*sizeof(int));
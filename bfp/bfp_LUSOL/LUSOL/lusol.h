@@ -258,7 +258,8 @@ typedef void LUSOLlogfunc(void *lp, void *userhandle, char *buf);
 /* Sparse matrix data */
 typedef struct _LUSOLmat {
   REAL *a;
-  int  *lenx, *indr, *indc, *indx;
+  NZINDEX *lenx;
+  int  *indr, *indc, *indx;
 } LUSOLmat;
 
 
@@ -272,22 +273,26 @@ typedef struct _LUSOLrec {
     void       *loghandle;
   LUSOLlogfunc *debuginfo;
 
-  /* Parameter storage arrays */
-  int    luparm[LUSOL_IP_LASTITEM + 1];
+  /* Parameter storage arrays; luparm also returns non-zero counts and positions */
+  NZINDEX luparm[LUSOL_IP_LASTITEM + 1];
   REAL   parmlu[LUSOL_RP_LASTITEM + 1];
 
   /* Arrays of length lena+1 */
-  int    lena, nelem;
+  NZINDEX lena, nelem;
   int    *indc, *indr;
   REAL   *a;
+  int    memalign;                   /* Byte alignment of these arrays, 0 for the default */
+  int    memhugesize;                /* Minimum size in bytes for huge page advice, 0 for none */
 
   /* Arrays of length maxm+1 (row storage) */
   int    maxm, m;
-  int    *lenr, *ip, *iqloc, *ipinv, *locr;
+  int    *lenr, *ip, *iqloc, *ipinv;
+  NZINDEX *locr;
 
   /* Arrays of length maxn+1 (column storage) */
   int    maxn, n;
-  int    *lenc, *iq, *iploc, *iqinv, *locc;
+  int    *lenc, *iq, *iploc, *iqinv;
+  NZINDEX *locc;
   REAL   *w, *vLU6L;
 
   /* List of singular columns, with dynamic size allocation */
@@ -313,13 +318,13 @@ typedef struct _LUSOLrec {
 
 
 LUSOLrec *LUSOL_create(FILE *outstream, int msgfil, int pivotmodel, int updatelimit);
-MYBOOL LUSOL_sizeto(LUSOLrec *LUSOL, int init_r, int init_c, int init_a);
+MYBOOL LUSOL_sizeto(LUSOLrec *LUSOL, int init_r, int init_c, NZINDEX init_a);
 MYBOOL LUSOL_assign(LUSOLrec *LUSOL, int iA[], int jA[], REAL Aij[],
-                                     int nzcount, MYBOOL istriplet);
+                                     NZINDEX nzcount, MYBOOL istriplet);
 void LUSOL_clear(LUSOLrec *LUSOL, MYBOOL nzonly);
 void LUSOL_free(LUSOLrec *LUSOL);
 
-LUSOLmat *LUSOL_matcreate(int dim, int nz);
+LUSOLmat *LUSOL_matcreate(int dim, NZINDEX nz);
 void LUSOL_matfree(LUSOLmat **mat);
 
 int LUSOL_loadColumn(LUSOLrec *LUSOL, int iA[], int jA, REAL Aij[], int nzcount, int offset1);
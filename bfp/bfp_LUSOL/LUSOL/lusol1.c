@@ -515,10 +515,11 @@ void LU1PQ3(LUSOLrec *LUSOL, int MN, int LEN[], int IPERM[], int IW[], int *NRAN
    27 Mar 2001: Decided to use only ind(l) > 0 and = 0 in lu1fad.
                 Still have to keep entries with len(i) = 0.
    ================================================================== */
-void LU1REC(LUSOLrec *LUSOL, int N, MYBOOL REALS, int *LTOP,
-                             int IND[], int LEN[], int LOC[])
+void LU1REC(LUSOLrec *LUSOL, int N, MYBOOL REALS, NZINDEX *LTOP,
+                             int IND[], int LEN[], NZINDEX LOC[])
 {
-  int  NEMPTY, I, LENI, L, LEND, K, KLAST, ILAST, LPRINT;
+  int     NEMPTY, I, LENI, ILAST, LPRINT;
+  NZINDEX L, LEND, K, KLAST;
 
   NEMPTY = 0;
   for(I = 1; I <= N; I++) {
@@ -554,7 +555,7 @@ void LU1REC(LUSOLrec *LUSOL, int N, MYBOOL REALS, int *LTOP,
       if(REALS)
         LUSOL->a[K] = LUSOL->a[L];
       LOC[I] = KLAST+1;
-      LEN[I] = K-KLAST;
+      LEN[I] = (int) (K-KLAST);
       KLAST = K;
     }
   }
@@ -571,8 +572,8 @@ void LU1REC(LUSOLrec *LUSOL, int N, MYBOOL REALS, int *LTOP,
   }
   LPRINT = LUSOL->luparm[LUSOL_IP_PRINTLEVEL];
   if(LPRINT>=LUSOL_MSG_PIVOT)
-    LUSOL_report(LUSOL, 0, "lu1rec.  File compressed from %d to %d\n",
-                        *LTOP,K,REALS,NEMPTY);
+    LUSOL_report(LUSOL, 0, "lu1rec.  File compressed from %.0f to %.0f\n",
+                        (double) *LTOP,(double) K,REALS,NEMPTY);
 /*      ncp */
   LUSOL->luparm[LUSOL_IP_COMPRESSIONS_LU]++;
 /*      Return ilast in ind(ltop + 1). */
@@ -589,7 +590,8 @@ void LU1REC(LUSOLrec *LUSOL, int N, MYBOOL REALS, int *LTOP,
    ================================================================== */
 void LU1SLK(LUSOLrec *LUSOL)
 {
-  int J, LC1, LQ, LQ1, LQ2;
+  int     J, LQ, LQ1, LQ2;
+  NZINDEX LC1;
 
   for(J = 1; J <= LUSOL->n; J++) {
     LUSOL->w[J] = 0;
@@ -660,14 +662,14 @@ void LU1SLK(LUSOLrec *LUSOL)
                 have ilast and jlast.)
    ================================================================== */
 void LU1GAU(LUSOLrec *LUSOL, int MELIM, int NSPARE,
-            REAL SMALL, int LPIVC1, int LPIVC2, int *LFIRST, int LPIVR2,
-            int LFREE, int MINFRE, int ILAST, int *JLAST, int *LROW, int *LCOL,
-            int *LU, int *NFILL,
+            REAL SMALL, NZINDEX LPIVC1, NZINDEX LPIVC2, NZINDEX *LFIRST, NZINDEX LPIVR2,
+            NZINDEX LFREE, NZINDEX MINFRE, int ILAST, int *JLAST, NZINDEX *LROW, NZINDEX *LCOL,
+            NZINDEX *LU, NZINDEX *NFILL,
             int MARK[],  REAL AL[], int MARKL[], REAL AU[], int IFILL[], int JFILL[])
 {
-  MYBOOL ATEND;
-  int    LR, J, LENJ, NFREE, LC1, LC2, NDONE, NDROP, L, I, LL, K,
-         LR1, LAST, LREP, L1, L2, LC, LENI;
+  MYBOOL  ATEND;
+  int     J, LENJ, NDONE, NDROP, I, LL, LENI;
+  NZINDEX LR, NFREE, LC1, LC2, L, K, LR1, LAST, LREP, L1, L2, LC;
   register REAL UJ;
   REAL   AIJ;
 
@@ -901,9 +903,10 @@ x900:
 void LU1MAR(LUSOLrec *LUSOL, int MAXMN, MYBOOL TCP, REAL AIJTOL, REAL LTOL,
             int MAXCOL, int MAXROW, int *IBEST, int *JBEST, int *MBEST)
 {
-  int  KBEST, NCOL, NROW, NZ1, NZ, LQ1, LQ2, LQ, J, LC1, LC2, LC, I, LEN1, MERIT, LP1,
-       LP2, LP, LR1, LR2, LR;
-  REAL ABEST, LBEST, AMAX, AIJ, CMAX;
+  int     KBEST, NCOL, NROW, NZ1, NZ, LQ1, LQ2, LQ, J, I, LEN1, MERIT, LP1,
+          LP2, LP;
+  NZINDEX LC1, LC2, LC, LR1, LR2, LR;
+  REAL    ABEST, LBEST, AMAX, AIJ, CMAX;
 
   ABEST = ZERO;
   LBEST = ZERO;
@@ -1152,8 +1155,9 @@ x900:
 void LU1MCP(LUSOLrec *LUSOL, REAL AIJTOL, int *IBEST, int *JBEST, int *MBEST,
             int HLEN, REAL HA[], int HJ[])
 {
-  int  J, KHEAP, LC, LC1, LC2, LENJ, MAXCOL, NCOL, NZ1, I, LEN1, MERIT;
-  REAL ABEST, AIJ, AMAX, CMAX, LBEST;
+  int     J, KHEAP, LENJ, MAXCOL, NCOL, NZ1, I, LEN1, MERIT;
+  NZINDEX LC, LC1, LC2;
+  REAL    ABEST, AIJ, AMAX, CMAX, LBEST;
 
 /*      ------------------------------------------------------------------
         Search up to maxcol columns stored at the top of the heap.
@@ -1263,9 +1267,10 @@ x900:
 void LU1MRP(LUSOLrec *LUSOL, int MAXMN, REAL LTOL, int MAXCOL, int MAXROW,
   int *IBEST, int *JBEST, int *MBEST, REAL AMAXR[])
 {
-  int  I, J, KBEST, LC, LC1, LC2, LEN1, LP, LP1, LP2, LQ, LQ1,
-       LQ2, LR, LR1, LR2, MERIT, NCOL, NROW, NZ, NZ1;
-  REAL ABEST, AIJ, AMAX, ATOLI, ATOLJ;
+  int     I, J, KBEST, LEN1, LP, LP1, LP2, LQ, LQ1,
+          LQ2, MERIT, NCOL, NROW, NZ, NZ1;
+  NZINDEX LC, LC1, LC2, LR, LR1, LR2;
+  REAL    ABEST, AIJ, AMAX, ATOLI, ATOLJ;
 
 /*      ------------------------------------------------------------------
         Search cols of length nz = 1, then rows of length nz = 1,
@@ -1454,8 +1459,9 @@ x900:
 void LU1MSP(LUSOLrec *LUSOL, int MAXMN, REAL LTOL, int MAXCOL,
             int *IBEST, int *JBEST, int *MBEST)
 {
-  int  I, J, KBEST, LC, LC1, LC2, LQ, LQ1, LQ2, MERIT, NCOL, NZ, NZ1;
-  REAL ABEST, AIJ, AMAX, ATOLJ;
+  int     I, J, KBEST, LQ, LQ1, LQ2, MERIT, NCOL, NZ, NZ1;
+  NZINDEX LC, LC1, LC2;
+  REAL    ABEST, AIJ, AMAX, ATOLJ;
 
 /*      ------------------------------------------------------------------
         Search cols of length nz = 1, then cols of length nz = 2, etc.
@@ -1564,10 +1570,11 @@ x900:
                 the current column is empty (i.e. LENJ==0)
                 Yin Zhang <yzhang@cs.utexas.edu>
    ================================================================== */
-void LU1MXC(LUSOLrec *LUSOL, int K1, int K2, int IX[])
+void LU1MXC(LUSOLrec *LUSOL, NZINDEX K1, NZINDEX K2, int IX[])
 {
-  int  I, J, K, L, LC, LENJ;
-  REAL AMAX;
+  int     I, J, LENJ;
+  NZINDEX K, L, LC;
+  REAL    AMAX;
 
   for(K = K1; K <= K2; K++) {
     J = IX[K];
@@ -1600,15 +1607,17 @@ void LU1MXC(LUSOLrec *LUSOL, int K1, int K2, int IX[])
    11 Jun 2002: First version of lu1mxr.
                 Allow for empty columns.
    ================================================================== */
-void LU1MXR(LUSOLrec *LUSOL, int K1, int K2, int IX[], REAL AMAXR[])
+void LU1MXR(LUSOLrec *LUSOL, NZINDEX K1, NZINDEX K2, int IX[], REAL AMAXR[])
 {
 #define FastMXR
 #ifdef FastMXR
-  static int  I, *J, *IC, K, LC, LC1, LC2, LR, LR1, LR2;
-  static REAL AMAX;
+  static int     I, *J, *IC;
+  static NZINDEX K, LC, LC1, LC2, LR, LR1, LR2;
+  static REAL    AMAX;
 #else
-  int  I, J, K, LC, LC1, LC2, LR, LR1, LR2;
-  REAL AMAX;
+  int     I, J;
+  NZINDEX K, LC, LC1, LC2, LR, LR1, LR2;
+  REAL    AMAX;
 #endif
 
   for(K = K1; K <= K2; K++) {
@@ -1657,14 +1666,14 @@ void LU1MXR(LUSOLrec *LUSOL, int K1, int K2, int IX[], REAL AMAXR[])
    05 Feb 1994: Column interchanges added to lu1DPP.
    08 Feb 1994: ipinv reconstructed, since lu1pq3 may alter ip.
    ================================================================== */
-void LU1FUL(LUSOLrec *LUSOL, int LEND, int LU1, MYBOOL TPP,
+void LU1FUL(LUSOLrec *LUSOL, NZINDEX LEND, NZINDEX LU1, MYBOOL TPP,
             int MLEFT, int NLEFT, int NRANK, int NROWU,
-            int *LENL, int *LENU, int *NSING,
+            NZINDEX *LENL, NZINDEX *LENU, int *NSING,
             MYBOOL KEEPLU, REAL SMALL, REAL D[], int IPVT[])
 {
-  int  L, I, J, IPBASE, LDBASE, LQ, LC1, LC2, LC, LD, LKK, LKN, LU, K, L1,
-       L2, IBEST, JBEST, LA, LL, NROWD, NCOLD;
-  REAL AI, AJ;
+  int     L, I, J, IPBASE, LQ, K, L1, L2, IBEST, JBEST, NROWD, NCOLD;
+  NZINDEX LDBASE, LC1, LC2, LC, LD, LKK, LKN, LU, LA, LL;
+  REAL    AI, AJ;
 
 /*      ------------------------------------------------------------------
         If lu1pq3 moved any empty rows, reset ipinv = inverse of ip.
@@ -1682,8 +1691,8 @@ void LU1FUL(LUSOLrec *LUSOL, int LEND, int LU1, MYBOOL TPP,
   MEMCLEAR((D+1), LEND);
 #else
 /*   dload(LEND, ZERO, D, 1); */
-  for(J = 1; J <= LEND; J++)
-    D[J] = ZERO;
+  for(LD = 1; LD <= LEND; LD++)
+    D[LD] = ZERO;
 #endif
 
   IPBASE = NROWU-1;
@@ -1716,7 +1725,7 @@ void LU1FUL(LUSOLrec *LUSOL, int LEND, int LU1, MYBOOL TPP,
 #ifdef LUSOLFastCopy
   MEMCOPY(LUSOL->a+1,D+1,LEND);
 #else
-  dcopy(LEND,D,1,LUSOL->a,1);
+  dcopy((int) LEND,D,1,LUSOL->a,1);
 #endif
 #ifdef ClassicdiagU
   LUSOL->diagU = LUSOL->a + (LUSOL->lena-LUSOL->n);
@@ -1807,9 +1816,10 @@ void LU1FUL(LUSOLrec *LUSOL, int LEND, int LU1, MYBOOL TPP,
    17 Oct 2000: a, indc, indr now have size lena to allow nelem = 0.
    ================================================================== */
 void LU1OR1(LUSOLrec *LUSOL, REAL SMALL,
-            REAL *AMAX, int *NUMNZ, int *LERR, int *INFORM)
+            REAL *AMAX, NZINDEX *NUMNZ, NZINDEX *LERR, int *INFORM)
 {
-  int I, J, L, LDUMMY;
+  int     I, J;
+  NZINDEX L, LDUMMY;
 
 #ifdef LUSOLFastClear
   MEMCLEAR((LUSOL->lenr+1), LUSOL->m);
@@ -1871,8 +1881,9 @@ x910:
    ================================================================== */
 void LU1OR2(LUSOLrec *LUSOL)
 {
-  REAL ACE, ACEP;
-  int  L, J, I, JCE, ICE, ICEP, JCEP, JA, JB;
+  REAL    ACE, ACEP;
+  int     J, JCE, ICE, ICEP, JCEP;
+  NZINDEX L, I, LDUMMY, JA, JB;
 
 /*      Set  loc(j)  to point to the beginning of column  j. */
   L = 1;
@@ -1891,7 +1902,7 @@ void LU1OR2(LUSOLrec *LUSOL)
     ICE = LUSOL->indc[I];
     LUSOL->indr[I] = 0;
 /*         Chain from current entry. */
-    for(J = 1; J <= LUSOL->nelem; J++) {
+    for(LDUMMY = 1; LDUMMY <= LUSOL->nelem; LDUMMY++) {
 /*            The current entry is not in the correct position.
               Determine where to store it. */
       L = LUSOL->locc[JCE];
@@ -1930,9 +1941,10 @@ void LU1OR2(LUSOLrec *LUSOL)
    xx Feb 1985: Original version.
    17 Oct 2000: indc, indr now have size lena to allow nelem = 0.
    ================================================================== */
-void LU1OR3(LUSOLrec *LUSOL, int *LERR, int *INFORM)
+void LU1OR3(LUSOLrec *LUSOL, NZINDEX *LERR, int *INFORM)
 {
-  int I, J, L1, L2, L;
+  int     I, J;
+  NZINDEX L1, L2, L;
 
 #ifdef LUSOLFastClear
   MEMCLEAR((LUSOL->ip+1), LUSOL->m);
@@ -1970,7 +1982,8 @@ x910:
    ================================================================== */
 void LU1OR4(LUSOLrec *LUSOL)
 {
-  int L, I, L2, J, JDUMMY, L1, LR;
+  int     I, J, JDUMMY;
+  NZINDEX L, L2, L1, LR;
 
 /*      Initialize  locr(i)  to point just beyond where the
         last component of row  i  will be stored. */
@@ -2014,10 +2027,11 @@ void LU1OR4(LUSOLrec *LUSOL)
    23 Mar 2001: ilast used and updated.
    ================================================================== */
 void LU1PEN(LUSOLrec *LUSOL, int NSPARE, int *ILAST,
-            int LPIVC1, int LPIVC2, int LPIVR1, int LPIVR2,
-            int *LROW, int IFILL[], int JFILL[])
+            NZINDEX LPIVC1, NZINDEX LPIVC2, NZINDEX LPIVR1, NZINDEX LPIVR2,
+            NZINDEX *LROW, int IFILL[], int JFILL[])
 {
-  int  LL, LC, L, I, LR1, LR2, LR, LU, J, LC1, LC2, LAST;
+  int     LL, I, LU, J;
+  NZINDEX LC, L, LR1, LR2, LR, LC1, LC2, LAST;
 
   LL = 0;
   for(LC = LPIVC1; LC <= LPIVC2; LC++) {
@@ -2226,25 +2240,26 @@ void LU1PEN(LUSOLrec *LUSOL, int NSPARE, int *ILAST,
    ================================================================== */
 void LU1FAD(LUSOLrec *LUSOL,
 #ifdef ClassicHamaxR
-            int LENA2, int LENH, REAL HA[], int HJ[], int HK[], REAL AMAXR[],
+            NZINDEX LENA2, int LENH, REAL HA[], int HJ[], int HK[], REAL AMAXR[],
 #endif
-            int *INFORM, int *LENL, int *LENU, int *MINLEN,
-            int *MERSUM, int *NUTRI, int *NLTRI,
+            int *INFORM, NZINDEX *LENL, NZINDEX *LENU, NZINDEX *MINLEN,
+            NZINDEX *MERSUM, int *NUTRI, int *NLTRI,
             int *NDENS1, int *NDENS2, int *NRANK,
             REAL *LMAX, REAL *UMAX, REAL *DUMAX, REAL *DUMIN, REAL *AKMAX)
 {
-  MYBOOL UTRI, LTRI, SPARS1, SPARS2, DENSE, DENSLU, KEEPLU, TCP, TPP, TRP,TSP;
-  int    HLEN, HOPS, H, LPIV, LPRINT, MAXCOL, MAXROW, ILAST, JLAST, LFILE, LROW, LCOL,
-         MINMN, MAXMN, NZLEFT, NSPARE, LU1, KK, J, LC, MLEFT, NLEFT, NROWU,
-         LQ1, LQ2, JBEST, LQ, I, IBEST, MBEST, LEND, NFREE, LD, NCOLD, NROWD,
-         MELIM, NELIM, JMAX, IMAX, LL1, LSAVE, LFREE, LIMIT, MINFRE, LPIVR, LPIVR1, LPIVR2,
-         L, LPIVC, LPIVC1, LPIVC2, KBEST, LU, LR, LENJ, LC1, LAST, LL, LS,
-         LENI, LR1, LFIRST, NFILL, NZCHNG, K, MRANK, NSING;
-  REAL   LIJ, LTOL, SMALL, USPACE, DENS1, DENS2, AIJMAX, AIJTOL, AMAX, ABEST, DIAG, V;
+  MYBOOL  UTRI, LTRI, SPARS1, SPARS2, DENSE, DENSLU, KEEPLU, TCP, TPP, TRP,TSP;
+  int     HLEN, HOPS, H, LPIV, LPRINT, MAXCOL, MAXROW, ILAST, JLAST,
+          MINMN, MAXMN, NSPARE, J, MLEFT, NLEFT, NROWU,
+          LQ1, LQ2, JBEST, LQ, I, IBEST, MBEST, NCOLD, NROWD,
+          MELIM, NELIM, JMAX, IMAX, KBEST, LENJ, LENI, NZCHNG, K, MRANK, NSING;
+  NZINDEX LFILE, LROW, LCOL, NZLEFT, LU1, KK, LC, LEND, NFREE, LD,
+          LL1, LSAVE, LFREE, LIMIT, MINFRE, LPIVR, LPIVR1, LPIVR2,
+          L, LPIVC, LPIVC1, LPIVC2, LU, LR, LC1, LAST, LL, LS, LR1, LFIRST, NFILL;
+  REAL    LIJ, LTOL, SMALL, USPACE, DENS1, DENS2, AIJMAX, AIJTOL, AMAX, ABEST, DIAG, V;
 #ifdef ClassicHamaxR
-  int    LDIAGU;
+  NZINDEX LDIAGU;
 #else
-  int    LENA2 = LUSOL->lena;
+  NZINDEX LENA2 = LUSOL->lena;
 #endif
 
 #ifdef UseTimer
@@ -2575,7 +2590,7 @@ x250:
            See if we can finish quickly.
            --------------------------------------------------------------- */
     if(DENSE) {
-      LEND = MLEFT*NLEFT;
+      LEND = (NZINDEX) MLEFT*NLEFT;
       NFREE = LU1-1;
       if(NFREE>=2*LEND) {
 /*               There is room to treat the remaining matrix as
@@ -2676,7 +2691,7 @@ x300:
 #else  /* Version by Kjell Eikland (from luparm[LUSOL_IP_MINIMUMLENA] and safety margin) */
     L  = (KEEPLU ? MAX(LROW, LCOL) + 2*(LUSOL->m+LUSOL->n) : 0);
     L *= LUSOL_MULT_nz_a;
-    SETMAX(L, NROWD*NCOLD);
+    SETMAX(L, (NZINDEX) NROWD*NCOLD);
 #endif
 
     /* Do the memory expansion */
@@ -2694,14 +2709,14 @@ x300:
       AMAXR += L;
 #endif
     }
-    LIMIT = (int) (USPACE*LFILE)+LUSOL->m+LUSOL->n+1000;
+    LIMIT = (NZINDEX) (USPACE*LFILE)+LUSOL->m+LUSOL->n+1000;
 
 /*         Make sure the column file has room.
            Also force a compression if its length exceeds a certain limit. */
 #ifdef StaticMemAlloc
     MINFRE = NCOLD+MELIM;
 #else
-    MINFRE = NROWD*NCOLD;
+    MINFRE = (NZINDEX) NROWD*NCOLD;
 #endif
     NFREE = LFREE-LCOL;
     if(NFREE<MINFRE || LCOL>LIMIT) {
@@ -2717,7 +2732,7 @@ x300:
 #ifdef StaticMemAlloc
     MINFRE = NCOLD+MELIM;
 #else
-    MINFRE = NROWD*NCOLD;
+    MINFRE = (NZINDEX) NROWD*NCOLD;
 #endif
     NFREE = LFREE-LROW;
     if(NFREE<MINFRE || LROW>LIMIT) {
@@ -2847,7 +2862,7 @@ x300:
       LUSOL->indr[LL] = 0;
       LUSOL->indc[LS] = LENI;
       LUSOL->indr[LS] = LUSOL->iqloc[I];
-      LUSOL->iqloc[I] = LSAVE-LS;
+      LUSOL->iqloc[I] = (int) (LSAVE-LS);
     }
 /*         ===============================================================
            Do the Gaussian elimination.
@@ -3043,7 +3058,7 @@ x900:
     timer ( "start", 17 );
 #endif
     LU1FUL(LUSOL, LEND,LU1,TPP,MLEFT,NLEFT,*NRANK,NROWU,LENL,LENU,
-           &NSING,KEEPLU,SMALL,LUSOL->a+LD-LUSOL_ARRAYOFFSET,LUSOL->locr);
+           &NSING,KEEPLU,SMALL,LUSOL->a+LD-LUSOL_ARRAYOFFSET,(int *) LUSOL->locr);
 /* ***     21 Dec 1994: Bug in next line.
    ***     nrank  = nrank - nsing */
     *NRANK = MINMN-NSING;
@@ -3357,11 +3372,14 @@ x990:
 void LU1FAC(LUSOLrec *LUSOL, int *INFORM)
 {
   MYBOOL  KEEPLU, TCP, TPP, TRP, TSP;
-  int     LPIV, NELEM0, LPRINT, MINLEN, NUML0, LENL, LENU, LROW, MERSUM,
-          NUTRI, NLTRI, NDENS1, NDENS2, NRANK, NSING, JSING, JUMIN, NUMNZ, LERR,
-          LU, LL, LM, LTOPL, K, I, LENUK, J, LENLK, IDUMMY, LLSAVE, NMOVE, L2, L, NCP, NBUMP;
+  int     LPIV, LPRINT, NUML0,
+          NUTRI, NLTRI, NDENS1, NDENS2, NRANK, NSING, JSING, JUMIN,
+          K, I, LENUK, J, LENLK, NCP, NBUMP;
+  NZINDEX NELEM0, MINLEN, LENL, LENU, LROW, MERSUM, NUMNZ, LERR,
+          LU, LL, LM, LTOPL, IDUMMY, LLSAVE, NMOVE, L2, L;
 #ifdef ClassicHamaxR
-  int     LENH, LENA2, LOCH, LMAXR;
+  int     LENH;
+  NZINDEX LENA2, LOCH, LMAXR;
 #endif
 
   REAL    LMAX, LTOL, SMALL, AMAX, UMAX, DUMAX, DUMIN, AKMAX, DM, DN, DELEM, DENSTY,
@@ -3432,9 +3450,9 @@ void LU1FAC(LUSOLrec *LUSOL, int *INFORM)
   LU1OR1(LUSOL, SMALL,&AMAX,&NUMNZ,&LERR,INFORM);
   if(LPRINT>=LUSOL_MSG_STATISTICS) {
     DENSTY = (100*DELEM)/(DM*DN);
-    LUSOL_report(LUSOL, 0, "m:%6d %c n:%6d  nzcount:%9d  Amax:%g  Density:%g\n",
+    LUSOL_report(LUSOL, 0, "m:%6d %c n:%6d  nzcount:%9.0f  Amax:%g  Density:%g\n",
                            LUSOL->m, relationChar(LUSOL->m, LUSOL->n), LUSOL->n,
-                           LUSOL->nelem, AMAX, DENSTY);
+                           (double) LUSOL->nelem, AMAX, DENSTY);
   }
   if(*INFORM!=LUSOL_INFORM_LUSUCCESS)
     goto x930;
@@ -3624,20 +3642,20 @@ void LU1FAC(LUSOLrec *LUSOL, int *INFORM)
 x930:
   *INFORM = LUSOL_INFORM_ADIMERR;
   if(LPRINT>=LUSOL_MSG_SINGULARITY)
-    LUSOL_report(LUSOL, 0, "lu1fac  error...\nentry  a[%d]  has an illegal row (%d) or column (%d) index\n",
-                        LERR,LUSOL->indc[LERR],LUSOL->indr[LERR]);
+    LUSOL_report(LUSOL, 0, "lu1fac  error...\nentry  a[%.0f]  has an illegal row (%d) or column (%d) index\n",
+                        (double) LERR,LUSOL->indc[LERR],LUSOL->indr[LERR]);
   goto x990;
 x940:
   *INFORM = LUSOL_INFORM_ADUPLICATE;
   if(LPRINT>=LUSOL_MSG_SINGULARITY)
-    LUSOL_report(LUSOL, 0, "lu1fac  error...\nentry  a[%d]  is a duplicate with indeces indc=%d, indr=%d\n",
-                        LERR,LUSOL->indc[LERR],LUSOL->indr[LERR]);
+    LUSOL_report(LUSOL, 0, "lu1fac  error...\nentry  a[%.0f]  is a duplicate with indeces indc=%d, indr=%d\n",
+                        (double) LERR,LUSOL->indc[LERR],LUSOL->indr[LERR]);
   goto x990;
 x970:
   *INFORM = LUSOL_INFORM_ANEEDMEM;
   if(LPRINT>=LUSOL_MSG_SINGULARITY)
-    LUSOL_report(LUSOL, 0, "lu1fac  error...\ninsufficient storage; increase  lena  from %d to at least %d\n",
-                        LUSOL->lena, MINLEN);
+    LUSOL_report(LUSOL, 0, "lu1fac  error...\ninsufficient storage; increase  lena  from %.0f to at least %.0f\n",
+                        (double) LUSOL->lena, (double) MINLEN);
   goto x990;
 x980:
   *INFORM = LUSOL_INFORM_FATALERR;
@@ -3707,14 +3725,14 @@ x990:
   NBUMP = LUSOL->m-NUTRI-NLTRI;
   if(LPRINT>=LUSOL_MSG_STATISTICS) {
     if(TPP) {
-      LUSOL_report(LUSOL, 0, "Merit %g %d %d %d %g %d %d %g %g %d %d %d\n",
-                          AVGMER,LENL,LENL+LENU,NCP,DINCR,NUTRI,LENU,
+      LUSOL_report(LUSOL, 0, "Merit %g %.0f %.0f %d %g %d %.0f %g %g %d %d %d\n",
+                          AVGMER,(double) LENL,(double) (LENL+LENU),NCP,DINCR,NUTRI,(double) LENU,
                           LTOL,UMAX,UGRWTH,NLTRI,NDENS1,LMAX);
     }
     else {
-      LUSOL_report(LUSOL, 0, "Merit %s %g %d %d %d %g %d %d %g %g %d %d %d %g %g\n",
+      LUSOL_report(LUSOL, 0, "Merit %s %g %.0f %.0f %d %g %d %.0f %g %g %d %d %d %g %g\n",
                           LUSOL_pivotLabel(LUSOL),
-                          AVGMER,LENL,LENL+LENU,NCP,DINCR,NUTRI,LENU,
+                          AVGMER,(double) LENL,(double) (LENL+LENU),NCP,DINCR,NUTRI,(double) LENU,
                           LTOL,UMAX,UGRWTH,NLTRI,NDENS1,LMAX,AKMAX,AGRWTH);
     }
     LUSOL_report(LUSOL, 0, "bump%9d  dense2%7d  DUmax%g DUmin%g  conDU%g\n",
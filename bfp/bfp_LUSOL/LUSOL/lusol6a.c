@@ -67,11 +67,12 @@
    27 Jun 2004: (PEG) Allow write only if nout .gt. 0.
    ================================================================== */
 #ifdef UseOld_LU6CHK_20040510
-void LU6CHK(LUSOLrec *LUSOL, int MODE, int LENA2, int *INFORM)
+void LU6CHK(LUSOLrec *LUSOL, int MODE, NZINDEX LENA2, int *INFORM)
 {
-  MYBOOL KEEPLU;
-  int    I, J, JUMIN, K, L, L1, L2, LENL, LPRINT, NDEFIC, NRANK;
-  REAL   AIJ, DIAG, DUMAX, DUMIN, LMAX, UMAX, UTOL1, UTOL2;
+  MYBOOL  KEEPLU;
+  int     I, J, JUMIN, K, LPRINT, NDEFIC, NRANK;
+  NZINDEX L, L1, L2, LENL;
+  REAL    AIJ, DIAG, DUMAX, DUMIN, LMAX, UMAX, UTOL1, UTOL2;
 
   LPRINT = LUSOL->luparm[LUSOL_IP_PRINTLEVEL];
   KEEPLU = (MYBOOL) (LUSOL->luparm[LUSOL_IP_KEEPLU]!=0);
@@ -184,18 +185,19 @@ void LU6CHK(LUSOLrec *LUSOL, int MODE, int LENA2, int *INFORM)
     if(LPRINT>=LUSOL_MSG_SINGULARITY) {
       LUSOL_report(LUSOL, 0, "Singular(m%cn)  rank:%9d  n-rank:%8d  nsing:%9d\n",
                              relationChar(LUSOL->m, LUSOL->n),NRANK,NDEFIC,
-                             LUSOL->luparm[LUSOL_IP_SINGULARITIES]);
+                             (int) LUSOL->luparm[LUSOL_IP_SINGULARITIES]);
     }
   }
 /*      Exit. */
   LUSOL->luparm[LUSOL_IP_INFORM] = *INFORM;
 }
 #else
-void LU6CHK(LUSOLrec *LUSOL, int MODE, int LENA2, int *INFORM)
+void LU6CHK(LUSOLrec *LUSOL, int MODE, NZINDEX LENA2, int *INFORM)
 {
-  MYBOOL KEEPLU, TRP;
-  int    I, J, JUMIN, K, L, L1, L2, LENL, LDIAGU, LPRINT, NDEFIC, NRANK;
-  REAL   AIJ, DIAG, DUMAX, DUMIN, LMAX, UMAX, UTOL1, UTOL2;
+  MYBOOL  KEEPLU, TRP;
+  int     I, J, JUMIN, K, LPRINT, NDEFIC, NRANK;
+  NZINDEX L, L1, L2, LENL, LDIAGU;
+  REAL    AIJ, DIAG, DUMAX, DUMIN, LMAX, UMAX, UTOL1, UTOL2;
 
   LPRINT = LUSOL->luparm[LUSOL_IP_PRINTLEVEL];
   KEEPLU = (MYBOOL) (LUSOL->luparm[LUSOL_IP_KEEPLU] != 0);
@@ -330,7 +332,7 @@ void LU6CHK(LUSOLrec *LUSOL, int MODE, int LENA2, int *INFORM)
     if((LUSOL->outstream!=NULL) && (LPRINT>=LUSOL_MSG_SINGULARITY)) {
       LUSOL_report(LUSOL, 0, "Singular(m%cn)  rank:%9d  n-rank:%8d  nsing:%9d\n",
                              relationChar(LUSOL->m, LUSOL->n),NRANK,NDEFIC,
-                             LUSOL->luparm[LUSOL_IP_SINGULARITIES]);
+                             (int) LUSOL->luparm[LUSOL_IP_SINGULARITIES]);
     }
   }
 /*      Exit. */
@@ -354,8 +356,9 @@ void LU6CHK(LUSOLrec *LUSOL, int MODE, int LENA2, int *INFORM)
    ------------------------------------------------------------------ */
 void LU6L(LUSOLrec *LUSOL, int *INFORM, REAL V[], int NZidx[])
 {
-  int  JPIV, K, L, L1, LEN, LENL, LENL0, NUML, NUML0;
-  REAL SMALL;
+  int     JPIV, K, LEN, NUML0;
+  NZINDEX L, L1, LENL, LENL0, NUML;
+  REAL    SMALL;
   register REAL VPIV;
 #ifdef LUSOLFastSolve
   REAL *aptr;
@@ -446,8 +449,9 @@ void LU6L(LUSOLrec *LUSOL, int *INFORM, REAL V[], int NZidx[])
    ================================================================== */
 void LU6LD(LUSOLrec *LUSOL, int *INFORM, int MODE, REAL V[], int NZidx[])
 {
-  int  IPIV, K, L, L1, LEN, NUML0;
-  REAL DIAG, SMALL;
+  int     IPIV, K, LEN, NUML0;
+  NZINDEX L, L1;
+  REAL    DIAG, SMALL;
   register REAL VPIV;
 #ifdef LUSOLFastSolve
   REAL *aptr;
@@ -510,7 +514,8 @@ void LU6LT(LUSOLrec *LUSOL, int *INFORM, REAL V[], int NZidx[])
 #ifdef DoTraceL0
   REAL    TEMP;
 #endif
-  int     K, L, L1, L2, LEN, LENL, LENL0, NUML0;
+  int     K, LEN, NUML0;
+  NZINDEX L, L1, L2, LENL, LENL0;
   REAL    SMALL;
   register REALXP SUM;
   register REAL HOLD;
@@ -598,8 +603,9 @@ void LU6LT(LUSOLrec *LUSOL, int *INFORM, REAL V[], int NZidx[])
 
 void print_L0(LUSOLrec *LUSOL)
 {
-  int  I, J, K, L, L1, L2, LEN, LENL0, NUML0;
-  REAL *denseL0 = (REAL*) calloc(LUSOL->m+1, (LUSOL->n+1)*sizeof(*denseL0));
+  int     I, J, K, LEN, NUML0;
+  NZINDEX L, L1, L2, LENL0;
+  REAL    *denseL0 = (REAL*) calloc(LUSOL->m+1, (LUSOL->n+1)*sizeof(*denseL0));
 
   NUML0 = LUSOL->luparm[LUSOL_IP_COLCOUNT_L0];
   LENL0 = LUSOL->luparm[LUSOL_IP_NONZEROS_L0];
@@ -648,8 +654,9 @@ void LU6U(LUSOLrec *LUSOL, int *INFORM, REAL V[], REAL W[], int NZidx[])
   }
   /* Alternatively, do the standard column-based L0 version */
   else {
-    int  I, J, K, KLAST, L, L1, L2, L3, NRANK, NRANK1;
-    REAL SMALL;
+    int     I, J, K, KLAST, NRANK, NRANK1;
+    NZINDEX L, L1, L2, L3;
+    REAL    SMALL;
     register REALXP T;
 #ifdef LUSOLFastSolve
     REAL *aptr;
@@ -665,12 +672,11 @@ void LU6U(LUSOLrec *LUSOL, int *INFORM, REAL V[], REAL W[], int NZidx[])
       if(fabs(V[I])>SMALL)
         break;
     }
-    L = LUSOL->n;
 #ifdef LUSOLFastSolve
-    for(K = KLAST+1, jptr = LUSOL->iq+K; K <= L; K++, jptr++)
+    for(K = KLAST+1, jptr = LUSOL->iq+K; K <= LUSOL->n; K++, jptr++)
       W[*jptr] = ZERO;
 #else
-    for(K = KLAST+1; K <= L; K++) {
+    for(K = KLAST+1; K <= LUSOL->n; K++) {
       J = LUSOL->iq[K];
       W[J] = ZERO;
     }
@@ -722,9 +728,10 @@ void LU6U(LUSOLrec *LUSOL, int *INFORM, REAL V[], REAL W[], int NZidx[])
    ================================================================== */
 void LU6UT(LUSOLrec *LUSOL, int *INFORM, REAL V[], REAL W[], int NZidx[])
 {
-  int  I, J, K, L, L1, L2, NRANK, NRANK1,
-       *ip = LUSOL->ip + 1, *iq = LUSOL->iq + 1;
-  REAL SMALL;
+  int     I, J, K, NRANK, NRANK1,
+          *ip = LUSOL->ip + 1, *iq = LUSOL->iq + 1;
+  NZINDEX L, L1, L2;
+  REAL    SMALL;
   register REAL T;
 #ifdef LUSOLFastSolve
   REAL *aptr;
@@ -735,12 +742,11 @@ void LU6UT(LUSOLrec *LUSOL, int *INFORM, REAL V[], REAL W[], int NZidx[])
   SMALL = LUSOL->parmlu[LUSOL_RP_ZEROTOLERANCE];
   *INFORM = LUSOL_INFORM_LUSUCCESS;
   NRANK1 = NRANK+1;
-  L = LUSOL->m;
 #ifdef LUSOLFastSolve
-  for(K = NRANK1, jptr = LUSOL->ip+K; K <= L; K++, jptr++)
+  for(K = NRANK1, jptr = LUSOL->ip+K; K <= LUSOL->m; K++, jptr++)
     V[*jptr] = ZERO;
 #else
-  for(K = NRANK1; K <= L; K++) {
+  for(K = NRANK1; K <= LUSOL->m; K++) {
     I = LUSOL->ip[K];
     V[I] = ZERO;
   }
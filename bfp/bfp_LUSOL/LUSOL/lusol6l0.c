@@ -6,8 +6,9 @@
 MYBOOL LU1L0(LUSOLrec *LUSOL, LUSOLmat **mat, int *inform)
 {
   MYBOOL status = FALSE;
-  int    K, L, LL, L1, L2, LENL0, NUML0, I;
-  int    *lsumr;
+  int     K, NUML0, I;
+  NZINDEX L, LL, L1, L2, LENL0;
+  NZINDEX *lsumr;
 
   /* Assume success */
   *inform = LUSOL_INFORM_LUSUCCESS;
@@ -25,7 +26,7 @@ MYBOOL LU1L0(LUSOLrec *LUSOL, LUSOLmat **mat, int *inform)
     return( status );
 
   /* Allocate temporary array */
-  lsumr = (int *) LUSOL_CALLOC((LUSOL->m+1), sizeof(*lsumr));
+  lsumr = (NZINDEX *) LUSOL_CALLOC((LUSOL->m+1), sizeof(*lsumr));
   if(lsumr == NULL) {
     *inform = LUSOL_INFORM_NOMEMLEFT;
     return( status );
@@ -108,8 +109,9 @@ void LU6L0T_v(LUSOLrec *LUSOL, LUSOLmat *mat, REAL V[], int NZidx[], int *INFORM
 #ifdef DoTraceL0
   REAL TEMP;
 #endif
-  int  LEN, K, KK, L, L1, NUML0;
-  REAL SMALL;
+  int     LEN, K, KK, NUML0;
+  NZINDEX L, L1;
+  REAL    SMALL;
   register REAL VPIV;
 #if (defined LUSOLFastSolve) && !(defined DoTraceL0)
   REAL *aptr;
@@ -126,7 +128,7 @@ void LU6L0T_v(LUSOLrec *LUSOL, LUSOLmat *mat, REAL V[], int NZidx[], int *INFORM
     KK = mat->indx[K];
     L  = mat->lenx[KK];
     L1 = mat->lenx[KK-1];
-    LEN = L - L1;
+    LEN = (int) (L - L1);
     if(LEN == 0)
       continue;
     /* Get value of the corresponding active entry of V[] */
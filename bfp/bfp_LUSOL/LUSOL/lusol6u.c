@@ -6,8 +6,9 @@
 MYBOOL LU1U0(LUSOLrec *LUSOL, LUSOLmat **mat, int *inform)
 {
   MYBOOL status = FALSE;
-  int    K, L, LL, LENU, NUMU, J;
-  int    *lsumc;
+  int     K, NUMU, J;
+  NZINDEX L, LL, LENU;
+  NZINDEX *lsumc;
 
   /* Assume success */
   *inform = LUSOL_INFORM_LUSUCCESS;
@@ -25,7 +26,7 @@ MYBOOL LU1U0(LUSOLrec *LUSOL, LUSOLmat **mat, int *inform)
     return( status );
 
   /* Allocate temporary array */
-  lsumc = (int *) LUSOL_CALLOC((LUSOL->n+1), sizeof(*lsumc));
+  lsumc = (NZINDEX *) LUSOL_CALLOC((LUSOL->n+1), sizeof(*lsumc));
   if(lsumc == NULL) {
     *inform = LUSOL_INFORM_NOMEMLEFT;
     return( status );
@@ -97,8 +98,9 @@ void LU6U0_v(LUSOLrec *LUSOL, LUSOLmat *mat, REAL V[], REAL W[], int NZidx[], in
 #ifdef DoTraceU0
   REAL TEMP;
 #endif
-  int  LEN, I, K, L, L1, NRANK, NRANK1, KLAST;
-  REAL SMALL;
+  int     LEN, I, K, NRANK, NRANK1, KLAST;
+  NZINDEX L, L1;
+  REAL    SMALL;
   register REAL T;
 #if (defined xxLUSOLFastSolve) && !(defined DoTraceU0)
   REAL *aptr;
@@ -117,12 +119,11 @@ void LU6U0_v(LUSOLrec *LUSOL, LUSOLmat *mat, REAL V[], REAL W[], int NZidx[], in
     if(fabs(V[I])>SMALL)
       break;
   }
-  L = LUSOL->n;
 #ifdef xxLUSOLFastSolve
-  for(K = KLAST+1, jptr = LUSOL->iq+K; K <= L; K++, jptr++)
+  for(K = KLAST+1, jptr = LUSOL->iq+K; K <= LUSOL->n; K++, jptr++)
     W[*jptr] = ZERO;
 #else
-  for(K = KLAST+1; K <= L; K++) {
+  for(K = KLAST+1; K <= LUSOL->n; K++) {
     J = LUSOL->iq[K];
     W[J] = ZERO;
   }
@@ -132,7 +133,7 @@ void LU6U0_v(LUSOLrec *LUSOL, LUSOLmat *mat, REAL V[], REAL W[], int NZidx[], in
     I = mat->indx[K];
     L = mat->lenx[I];
     L1 = mat->lenx[I-1];
-    LEN = L - L1;
+    LEN = (int) (L - L1);
     T = V[I];
     if(fabs(T)<=SMALL) {
       W[K] = ZERO;
@@ -18,11 +18,12 @@
    ------------------------------------------------------------------
    09 May 1988: First f77 version.
    ================================================================== */
-void LU7ADD(LUSOLrec *LUSOL, int JADD, REAL V[], int LENL, int *LENU,
-  int *LROW, int NRANK, int *INFORM, int *KLAST, REAL *VNORM)
+void LU7ADD(LUSOLrec *LUSOL, int JADD, REAL V[], NZINDEX LENL, NZINDEX *LENU,
+  NZINDEX *LROW, int NRANK, int *INFORM, int *KLAST, REAL *VNORM)
 {
-  REAL SMALL;
-  int  K, I, LENI, MINFRE, NFREE, LR1, LR2, L;
+  REAL    SMALL;
+  int     K, I, LENI;
+  NZINDEX MINFRE, NFREE, LR1, LR2, L;
 #ifndef LUSOLFastMove
   int J;
 #endif
@@ -146,11 +147,12 @@ void LU7CYC(LUSOLrec *LUSOL, int KFIRST, int KLAST, int IX[])
    09 May 1988: First f77 version.
                 No longer calls lu7for at end.  lu8rpc, lu8mod do so.
    ================================================================== */
-void LU7ELM(LUSOLrec *LUSOL, int JELM, REAL V[], int *LENL,
-            int *LROW, int NRANK, int *INFORM, REAL *DIAG)
+void LU7ELM(LUSOLrec *LUSOL, int JELM, REAL V[], NZINDEX *LENL,
+            NZINDEX *LROW, int NRANK, int *INFORM, REAL *DIAG)
 {
-  REAL VI, VMAX, SMALL;
-  int  NRANK1, MINFRE, NFREE, KMAX, L, K, I, LMAX, IMAX, L1, L2;
+  REAL    VI, VMAX, SMALL;
+  int     NRANK1, KMAX, K, I, IMAX;
+  NZINDEX MINFRE, NFREE, L, LMAX, L1, L2;
 
 #ifdef ForceInitialization
   LMAX = 0;
@@ -263,13 +265,14 @@ x990:
       Jan 1985: Final f66 version.
    09 May 1988: First f77 version.
    ================================================================== */
-void LU7FOR(LUSOLrec *LUSOL, int KFIRST, int KLAST, int *LENL, int *LENU,
-                     int *LROW, int *INFORM, REAL *DIAG)
+void LU7FOR(LUSOLrec *LUSOL, int KFIRST, int KLAST, NZINDEX *LENL, NZINDEX *LENU,
+                     NZINDEX *LROW, int *INFORM, REAL *DIAG)
 {
-  MYBOOL SWAPPD;
-  int    KBEGIN, IW, LENW, LW1, LW2, JFIRST, MINFRE, NFREE, L, J, KSTART, KSTOP, K,
-         LFIRST, IV, LENV, LV1, JLAST, LV2, LV3, LV, JV, LW, LDIAG, LIMIT;
-  REAL   AMULT, LTOL, USPACE, SMALL, VJ, WJ;
+  MYBOOL  SWAPPD;
+  int     KBEGIN, IW, LENW, JFIRST, J, KSTART, KSTOP, K,
+          IV, LENV, JLAST, JV;
+  NZINDEX LW1, LW2, MINFRE, NFREE, L, LFIRST, LV1, LV2, LV3, LV, LW, LDIAG, LIMIT;
+  REAL    AMULT, LTOL, USPACE, SMALL, VJ, WJ;
 
   LTOL   = LUSOL->parmlu[LUSOL_RP_UPDATEMAX_Lij];
   SMALL  = LUSOL->parmlu[LUSOL_RP_ZEROTOLERANCE];
@@ -436,7 +439,8 @@ x360:
 #ifdef LUSOLFastMove
     L = LW2-LW1+1;
     if(L > 0) {
-      int loci, *locp;
+      NZINDEX loci;
+      int     *locp;
       for(loci = LW1, locp = LUSOL->indr+LW1;
           loci <= LW2; loci++, locp++) {
         (*LROW)++;
@@ -543,7 +547,7 @@ x910:
         This should prevent memory fragmentation when there is far more
         memory than necessary  (i.e. when  lena  is huge). */
 x950:
-  LIMIT = (int) (USPACE*(*LENU))+LUSOL->m+LUSOL->n+1000;
+  LIMIT = (NZINDEX) (USPACE*(*LENU))+LUSOL->m+LUSOL->n+1000;
   if(*LROW>LIMIT)
     LU1REC(LUSOL, LUSOL->m,TRUE,LROW,LUSOL->indr,LUSOL->lenr,LUSOL->locr);
   goto x990;
@@ -566,11 +570,12 @@ x990:
    -- Jul 1987: First version.
    09 May 1988: First f77 version.
    ================================================================== */
-void LU7RNK(LUSOLrec *LUSOL, int JSING, int *LENU,
-            int *LROW, int *NRANK, int *INFORM, REAL *DIAG)
+void LU7RNK(LUSOLrec *LUSOL, int JSING, NZINDEX *LENU,
+            NZINDEX *LROW, int *NRANK, int *INFORM, REAL *DIAG)
 {
-  REAL UTOL1, UMAX;
-  int  IW, LENW, L1, L2, LMAX, L, JMAX, KMAX;
+  REAL    UTOL1, UMAX;
+  int     IW, LENW, JMAX, KMAX;
+  NZINDEX L1, L2, LMAX, L;
 
 #ifdef ForceInitialization
   L1 = 0;
@@ -656,10 +661,11 @@ x900:
    -- Jul 1987: nrank added.
    10 May 1988: First f77 version.
    ================================================================== */
-void LU7ZAP(LUSOLrec *LUSOL, int JZAP, int *KZAP, int *LENU, int *LROW,
+void LU7ZAP(LUSOLrec *LUSOL, int JZAP, int *KZAP, NZINDEX *LENU, NZINDEX *LROW,
             int NRANK)
 {
-  int K, I, LENI, LR1, LR2, L;
+  int     K, I, LENI;
+  NZINDEX LR1, LR2, L;
 
   for(K = 1; K <= NRANK; K++) {
     I = LUSOL->ip[K];
@@ -687,8 +693,7 @@ x90:
       goto x800;
   }
 /*      nrank must be smaller than n because we haven't found kzap yet. */
-  L = LUSOL->n;
-  for(K = NRANK+1; K <= L; K++) {
+  for(K = NRANK+1; K <= LUSOL->n; K++) {
     *KZAP = K;
     if(LUSOL->iq[K]==JZAP)
       break;
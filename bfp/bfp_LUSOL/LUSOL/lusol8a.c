@@ -48,9 +48,10 @@ void LU8RPC(LUSOLrec *LUSOL, int MODE1, int MODE2,
             int JREP, REAL V[], REAL W[],
             int *INFORM, REAL *DIAG, REAL *VNORM)
 {
-  MYBOOL SINGLR;
-  int    LPRINT, NRANK, LENL, LENU, LROW, NRANK0, KREP, KLAST, IW, L1, J1, JSING;
-  REAL   UTOL1, UTOL2;
+  MYBOOL  SINGLR;
+  int     LPRINT, NRANK, NRANK0, KREP, KLAST, IW, J1, JSING;
+  NZINDEX LENL, LENU, LROW, L1;
+  REAL    UTOL1, UTOL2;
 
   LPRINT = LUSOL->luparm[LUSOL_IP_PRINTLEVEL];
   NRANK  = LUSOL->luparm[LUSOL_IP_RANK_U];
@@ -259,8 +260,8 @@ x920:
 x970:
   *INFORM = LUSOL_INFORM_ANEEDMEM;
   if(LPRINT>=LUSOL_MSG_SINGULARITY)
-    LUSOL_report(LUSOL, 0, "lu8rpc  error...\nInsufficient memory.    lena=%8d\n",
-                        LUSOL->lena);
+    LUSOL_report(LUSOL, 0, "lu8rpc  error...\nInsufficient memory.    lena=%8.0f\n",
+                        (double) LUSOL->lena);
   goto x990;
 /*      jrep  is out of range. */
 x980:
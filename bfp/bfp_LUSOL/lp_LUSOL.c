@@ -75,6 +75,12 @@ MYBOOL BFP_CALLMODEL bfp_resize(lprec *lp, int newsize)
 
     lu->LUSOL = LUSOL_create(NULL, 0, LUSOL_PIVMOD_TPP, bfp_pivotmax(lp)*0);
 
+    /* Follow the memory policy of the model for the factor storage */
+    if(lp->memory_policy & MEMORY_ALLOCMASK)
+      lu->LUSOL->memalign = DEF_MEMORYALIGN;
+    if(lp->memory_policy & MEMORY_HUGEPAGES)
+      lu->LUSOL->memhugesize = DEF_HUGEPAGELIMIT;
+
 #if 1
     lu->LUSOL->luparm[LUSOL_IP_ACCELERATION]  = LUSOL_AUTOORDER;
     lu->LUSOL->parmlu[LUSOL_RP_SMARTRATIO]    = 0.50;
@@ -149,15 +155,18 @@ void BFP_CALLMODEL bfp_free(lprec *lp)
 /* MUST MODIFY */
 int BFP_CALLMODEL bfp_nonzeros(lprec *lp, MYBOOL maximum)
 {
-  INVrec *lu;
+  INVrec   *lu;
+  NZINDEX  nz;
 
   lu = lp->invB;
   if(maximum == TRUE)
     return(lu->max_LUsize);
   else if(maximum == AUTOMATIC)
     return(lu->max_Bsize);
-  else
-    return(lu->LUSOL->luparm[LUSOL_IP_NONZEROS_L0]+lu->LUSOL->luparm[LUSOL_IP_NONZEROS_U0]);
+
+  /* The BFP interface reports counts as int; saturate under NZINDEX64 */
+  nz = lu->LUSOL->luparm[LUSOL_IP_NONZEROS_L0]+lu->LUSOL->luparm[LUSOL_IP_NONZEROS_U0];
+  return( (int) MIN(nz, MAXINT32) );
 /*    return(lu->LUSOL->luparm[LUSOL_IP_NONZEROS_ROW]); */
 }
 
@@ -165,18 +174,19 @@ int BFP_CALLMODEL bfp_nonzeros(lprec *lp, MYBOOL maximum)
 /* MUST MODIFY (or ignore) */
 int BFP_CALLMODEL bfp_memallocated(lprec *lp)
 {
-  int      mem;
+  REAL     mem;
   LUSOLrec *LUSOL = lp->invB->LUSOL;
 
-  mem = sizeof(REAL) * (LUSOL->lena+LUSOL->maxm+LUSOL_RP_LASTITEM);
-  mem += sizeof(int) * (2*LUSOL->lena+5*LUSOL->maxm+5*LUSOL->maxn+LUSOL_IP_LASTITEM);
+  mem = (REAL) sizeof(REAL) * (LUSOL->lena+LUSOL->maxm+LUSOL_RP_LASTITEM);
+  mem += (REAL) sizeof(int) * (2*LUSOL->lena+4*LUSOL->maxm+4*LUSOL->maxn);
+  mem += (REAL) sizeof(NZINDEX) * (LUSOL->maxm+LUSOL->maxn+LUSOL_IP_LASTITEM);
   if(LUSOL->luparm[LUSOL_IP_PIVOTTYPE] == LUSOL_PIVMOD_TCP)
     mem += sizeof(REAL) * LUSOL->maxn + 2*sizeof(REAL)*LUSOL->maxn;
   else if(LUSOL->luparm[LUSOL_IP_PIVOTTYPE] == LUSOL_PIVMOD_TRP)
     mem += sizeof(REAL) * LUSOL->maxn;
   if(!LUSOL->luparm[LUSOL_IP_KEEPLU])
     mem += sizeof(REAL) * LUSOL->maxn;
-  return( mem );
+  return( (int) MIN(mem, MAXINT32) );
 }
 
 
@@ -725,6 +735,14 @@ int BFP_CALLMODEL bfp_findredundant(lprec *lp, int items, getcolumnex_func cb, i
   }
   maprow[0] = n;
 
+  /* Also order the column map by pivot sequence, so that the dependent
+     columns are found after the first LUSOL_IP_RANK_U positions */
+  if(allocINT(lp, &nzrows, m+1, AUTOMATIC)) {
+    for(j = 1; j <= m; j++)
+      nzrows[j] = mapcol[LUSOL->iq[j]];
+    MEMCOPY(mapcol+1, nzrows+1, m);
+  }
+
   /* Clean up */
 Finish:
   LUSOL_free(LUSOL);
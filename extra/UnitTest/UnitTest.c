@@ -20357,6 +20357,51 @@ void UnitTest46()
 	}
 }
 
+/* A load_model_csc call with bad input must leave the model empty, so that a corrected retry is accepted */
+void UnitTest47()
+{
+	lprec *lp;
+	int ret;
+	NZINDEX col_start[] = {0, 2, 4};
+	int row_idx[] = {0, 1, 0, 2}, con_type[] = {0, LE, GE};
+	REAL values[] = {1, 1, 2, 1}, rhs[] = {0, 4, 1};
+	REAL lower[] = {0, 0, 3}, upper[] = {0, 10, 2};
+	int bad_idx[] = {0, 3, 0, 2};
+
+	lp = make_lp(0, 0);
+	assert(lp != NULL);
+	set_verbose(lp, 1);
+
+	ret = load_model_csc(lp, 2, 2, col_start, row_idx, values, lower, upper, NULL, rhs, con_type, NULL);
+	assert( !ret );
+	assert( (get_Nrows(lp) == 0) && (get_Ncolumns(lp) == 0) );
+
+	upper[2] = -INF;
+	lower[2] = -INF;
+	ret = load_model_csc(lp, 2, 2, col_start, row_idx, values, lower, upper, NULL, rhs, con_type, NULL);
+	assert( !ret );
+	assert( (get_Nrows(lp) == 0) && (get_Ncolumns(lp) == 0) );
+
+	upper[2] = 5;
+	lower[2] = 0;
+	ret = load_model_csc(lp, 2, 2, col_start, bad_idx, values, lower, upper, NULL, rhs, con_type, NULL);
+	assert( !ret );
+	assert( (get_Nrows(lp) == 0) && (get_Ncolumns(lp) == 0) );
+
+	ret = load_model_csc(lp, 2, 2, col_start, row_idx, values, lower, upper, NULL, rhs, con_type, NULL);
+	assert( ret );
+	assert( (get_Nrows(lp) == 2) && (get_Ncolumns(lp) == 2) );
+	assert( ISEQUAL(get_mat(lp, 0, 2), 2) );
+	assert( ISEQUAL(get_mat(lp, 2, 2), 1) );
+	assert( ISEQUAL(get_upbo(lp, 2), 5) );
+
+	ret = solve(lp);
+	assert( ret == OPTIMAL );
+	assert( ISEQUAL(get_objective(lp), 2) );
+
+	delete_lp(lp);
+}
+
 int main(void)
 {
   Init();
@@ -20409,6 +20454,7 @@ int main(void)
   printf("UnitTest44\n"); UnitTest44();
   printf("UnitTest45\n"); UnitTest45();
   printf("UnitTest46\n"); UnitTest46();
+  printf("UnitTest47\n"); UnitTest47();
 
   printf("Done\n");
 }
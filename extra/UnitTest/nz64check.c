@@ -0,0 +1,223 @@
+/* Check of the 64-bit non-zero positions of a -DNZINDEX64 build past INT_MAX.
+
+   A model with more than 2^31 real non-zeros does not fit in the memory of
+   most test machines, so column 1 is made a placeholder of 2^31+16 entries
+   in row 0 with value 0 that are never written: allocations of 1GB and more
+   are served by MAP_NORESERVE mappings, and untouched pages of those cost no
+   memory.  The columns after it then have all their non-zeros at positions
+   past INT_MAX, and the test appends, edits and deletes such columns and
+   reads them back through both the column storage and the row index.  The
+   placeholder itself is never read back.  Linux only; see the nz64check
+   script for the build. */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <assert.h>
+#include <malloc.h>
+#include <sys/mman.h>
+
+#include "lp_lib.h"
+#include "lp_matrix.h"
+
+#ifndef NZINDEX64
+  #error nz64check must be compiled with -DNZINDEX64
+#endif
+
+/* Large blocks are kept in lazily backed mappings */
+#define MAPPED_MIN  ((size_t) 1 << 30)
+#define MAPPED_MAX  64
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void  __libc_free(void *ptr);
+
+static struct {
+  void   *ptr;
+  size_t size;
+} mapped[MAPPED_MAX];
+
+static int findmapped(void *ptr)
+{
+  int i;
+
+  for(i = 0; i < MAPPED_MAX; i++)
+    if((ptr != NULL) && (mapped[i].ptr == ptr))
+      return( i );
+  return( -1 );
+}
+
+static void *newmapped(size_t size)
+{
+  int  i;
+  void *ptr;
+
+  for(i = 0; (i < MAPPED_MAX) && (mapped[i].ptr != NULL); i++);
+  if(i == MAPPED_MAX)
+    return( NULL );
+  ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if(ptr == MAP_FAILED)
+    return( NULL );
+  mapped[i].ptr = ptr;
+  mapped[i].size = size;
+  return( ptr );
+}
+
+void *malloc(size_t size)
+{
+  return( size >= MAPPED_MIN ? newmapped(size) : __libc_malloc(size) );
+}
+
+void *calloc(size_t count, size_t size)
+{
+  if((size > 0) && (count >= MAPPED_MIN / size))
+    return( newmapped(count * size) );
+  return( __libc_calloc(count, size) );
+}
+
+void free(void *ptr)
+{
+  int i = findmapped(ptr);
+
+  if(i < 0)
+    __libc_free(ptr);
+  else {
+    munmap(mapped[i].ptr, mapped[i].size);
+    mapped[i].ptr = NULL;
+  }
+}
+
+void *realloc(void *ptr, size_t size)
+{
+  int    i = findmapped(ptr);
+  size_t oldsize;
+  void   *newptr;
+
+  if(i >= 0) {
+    newptr = mremap(ptr, mapped[i].size, size, MREMAP_MAYMOVE);
+    if(newptr == MAP_FAILED)
+      return( NULL );
+    mapped[i].ptr = newptr;
+    mapped[i].size = size;
+    return( newptr );
+  }
+  if(size < MAPPED_MIN)
+    return( __libc_realloc(ptr, size) );
+  newptr = newmapped(size);
+  if((newptr != NULL) && (ptr != NULL)) {
+    oldsize = malloc_usable_size(ptr);
+    memcpy(newptr, ptr, (oldsize < size ? oldsize : size));
+    __libc_free(ptr);
+  }
+  return( newptr );
+}
+
+#define ISEQUAL(value1, value2) (fabs((value1) - (value2)) < 1e-9)
+
+static void checkrow(lprec *lp, int rownr, int count, int *colno, REAL *value)
+{
+  int  i, n, cols[8];
+  REAL vals[8];
+
+  n = get_rowex(lp, rownr, vals, cols);
+  assert( n == count );
+  for(i = 0; i < n; i++) {
+    assert( cols[i] == colno[i] );
+    assert( ISEQUAL(vals[i], value[i]) );
+  }
+}
+
+int main(void)
+{
+  lprec   *lp;
+  MATrec  *mat;
+  NZINDEX base = (NZINDEX) INT_MAX + 17, j, n;
+  int     ret, rows[3], cols[3];
+  REAL    vals[3];
+
+  lp = make_lp(3, 1);
+  assert( lp != NULL );
+  set_verbose(lp, NEUTRAL);
+  mat = lp->matA;
+
+  /* Turn column 1 into the placeholder of base entries in row 0; only the
+     entries of the allocation that existed before are cleared explicitly */
+  n = mat->mat_alloc;
+  ret = inc_mat_space(mat, base + 16);
+  assert( ret && (mat->mat_alloc > base + 16) );
+  for(j = 0; j < n; j++) {
+    COL_MAT_ROWNR(j) = 0;
+    COL_MAT_COLNR(j) = 1;
+    COL_MAT_VALUE(j) = 0;
+    mat->row_mat[j] = j;
+  }
+  mat->col_end[1] = base;
+  for(j = 0; j <= mat->rows; j++)
+    mat->row_end[j] = base;
+  mat->row_end_valid = TRUE;
+  mat->row_end_cols = 1;
+  mat->row_end_nz = base;
+  printf("Placeholder column of %.0f entries\n", (double) base);
+
+  /* mat_appendcol at positions past INT_MAX */
+  rows[0] = 1; rows[1] = 2; rows[2] = 3;
+  vals[0] = 1; vals[1] = 2; vals[2] = 3;
+  ret = add_columnex(lp, 3, vals, rows);
+  assert( ret );
+  rows[0] = 2; rows[1] = 3;
+  vals[0] = 4; vals[1] = 5;
+  ret = add_columnex(lp, 2, vals, rows);
+  assert( ret );
+  assert( mat_nonzeros(mat) == base + 5 );
+  assert( (mat->col_end[2] == base + 3) && (mat->col_end[3] == base + 5) );
+  assert( ISEQUAL(get_mat(lp, 3, 3), 5) && ISEQUAL(get_mat(lp, 1, 2), 1) );
+  assert( ISEQUAL(get_mat(lp, 1, 3), 0) );
+
+  /* Extend the row index over the appended columns */
+  cols[0] = 2; cols[1] = 3;
+  vals[0] = 2; vals[1] = 4;
+  checkrow(lp, 2, 2, cols, vals);
+  assert( mat->row_end_valid && (mat->row_end[mat->rows] == base + 5) );
+  assert( (mat->row_end[1] == base + 1) && (mat->row_end[2] == base + 3) );
+
+  /* Insert an element into a column past INT_MAX and reindex the rows */
+  ret = set_mat(lp, 1, 3, 7);
+  assert( ret );
+  assert( (mat_nonzeros(mat) == base + 6) && (mat->col_end[3] == base + 6) );
+  assert( ISEQUAL(get_mat(lp, 1, 3), 7) && ISEQUAL(get_mat(lp, 3, 3), 5) );
+  cols[0] = 2; cols[1] = 3;
+  vals[0] = 1; vals[1] = 7;
+  checkrow(lp, 1, 2, cols, vals);
+  cols[0] = 2; cols[1] = 3;
+  vals[0] = 3; vals[1] = 5;
+  checkrow(lp, 3, 2, cols, vals);
+
+  /* Delete an element again */
+  ret = set_mat(lp, 2, 2, 0);
+  assert( ret );
+  assert( mat_nonzeros(mat) == base + 5 );
+  cols[0] = 3;
+  vals[0] = 4;
+  checkrow(lp, 2, 1, cols, vals);
+
+  /* mat_shiftcols: delete column 2, which moves column 3 down past INT_MAX;
+     the column numbers of the moved entries are only renewed with the row index */
+  ret = del_column(lp, 2);
+  assert( ret );
+  assert( (get_Ncolumns(lp) == 2) && (mat_nonzeros(mat) == base + 3) );
+  assert( mat->col_end[2] == base + 3 );
+  for(j = base; j < base + 3; j++) {
+    assert( COL_MAT_ROWNR(j) == (int) (j - base + 1) );
+    assert( ISEQUAL(COL_MAT_VALUE(j), (j == base ? 7 : j - base + 3)) );
+  }
+  assert( ISEQUAL(get_mat(lp, 1, 2), 7) && ISEQUAL(get_mat(lp, 2, 2), 4) &&
+          ISEQUAL(get_mat(lp, 3, 2), 5) );
+
+  delete_lp(lp);
+  printf("Done\n");
+  return( 0 );
+}
@@ -0,0 +1,158 @@
+/* Accuracy and timing check of the REALXP accumulation modes.
+
+   Solves the models in this directory plus a series of Hilbert matrix models,
+   which are badly conditioned, and prints per model the solve status, the
+   objective value, the largest scaled row and bound violation and the solve
+   time.  Build it once with the default long double REALXP and once with
+   -DREALXP_COMPENSATED and compare the two outputs; the xpcheck script does
+   both and reports the differences. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "lp_lib.h"
+
+static char *models[] = {
+  "UnitTest1.lp", "UnitTest2.lp", "UnitTest3.lp", "UnitTest16.lp", "UnitTest17.lp",
+  "UnitTest20.lp", "UnitTest33.lp", "Unittest42.lp", "UnitTest43.lp", "UnitTest44.lp",
+  "UnitTest46.lp", "UnitTest6.mps", "UnitTest7.mps", "UnitTest8.mps", "demo_lag.lp",
+  "ex1.lp", "ex1sc.lp", "ex1sos.lp", "ex2.lp", "ex2sc.lp", "ex2sos.lp", "ex3.lp",
+  "ex3sos.lp", "ex4.lp", "ex4sos.lp", "ex5.lp", "ex6.lp", "ex7.lp", NULL
+};
+
+/* Largest violation of the row and column bounds by the solution, each relative
+   to the size of the bound; the row activities are recomputed in long double */
+static double residual(lprec *lp)
+{
+  int    i, j, rows = get_Nrows(lp), cols = get_Ncolumns(lp);
+  REAL   *x, *row, lo, hi, inf = get_infinite(lp);
+  long double act;
+  double viol, maxviol = 0;
+
+  row = (REAL *) malloc((1 + cols) * sizeof(*row));
+  if((row == NULL) || !get_ptr_variables(lp, &x)) {
+    free(row);
+    return( -1 );
+  }
+  for(i = 1; i <= rows; i++) {
+    get_row(lp, i, row);
+    act = 0;
+    for(j = 1; j <= cols; j++)
+      act += (long double) row[j] * x[j - 1];
+    lo = get_rh_lower(lp, i);
+    hi = get_rh_upper(lp, i);
+    viol = 0;
+    if((lo > -inf) && (act < lo))
+      viol = (double) (lo - act) / (1 + fabs(lo));
+    if((hi < inf) && (act > hi))
+      viol = (double) (act - hi) / (1 + fabs(hi));
+    if(viol > maxviol)
+      maxviol = viol;
+  }
+  for(j = 1; j <= cols; j++) {
+    if(is_semicont(lp, j) && (x[j - 1] == 0))
+      continue;
+    lo = get_lowbo(lp, j);
+    hi = get_upbo(lp, j);
+    viol = 0;
+    if((lo > -inf) && (x[j - 1] < lo))
+      viol = (lo - x[j - 1]) / (1 + fabs(lo));
+    if((hi < inf) && (x[j - 1] > hi))
+      viol = (x[j - 1] - hi) / (1 + fabs(hi));
+    if(viol > maxviol)
+      maxviol = viol;
+  }
+  free(row);
+  return( maxviol );
+}
+
+/* The n x n Hilbert system H x = H e with free x and objective sum(x); the
+   exact solution is x = e with objective n, but the condition number grows
+   like exp(3.5 n) */
+static lprec *hilbert(int n)
+{
+  lprec *lp;
+  int   i, j;
+  REAL  *row, rhs;
+
+  lp = make_lp(0, n);
+  row = (REAL *) malloc((1 + n) * sizeof(*row));
+  if((lp == NULL) || (row == NULL)) {
+    free(row);
+    return( lp );
+  }
+  set_add_rowmode(lp, TRUE);
+  for(j = 1; j <= n; j++) {
+    row[j] = 1;
+    set_unbounded(lp, j);
+  }
+  set_obj_fn(lp, row);
+  for(i = 1; i <= n; i++) {
+    rhs = 0;
+    for(j = 1; j <= n; j++) {
+      row[j] = 1.0 / (i + j - 1);
+      rhs += row[j];
+    }
+    add_constraint(lp, row, EQ, rhs);
+  }
+  set_add_rowmode(lp, FALSE);
+  free(row);
+  return( lp );
+}
+
+static double run(lprec *lp, char *name, int repeats)
+{
+  int     k, ret = NOMEMORY;
+  clock_t t0;
+  double  seconds;
+
+  if(lp == NULL) {
+    printf("%-16s %3s\n", name, "nil");
+    return( 0 );
+  }
+  set_verbose(lp, NEUTRAL);
+  set_timeout(lp, 10);
+  t0 = clock();
+  for(k = 0; k < repeats; k++) {
+    default_basis(lp);
+    ret = solve(lp);
+  }
+  seconds = (double) (clock() - t0) / CLOCKS_PER_SEC / repeats;
+  if((ret == OPTIMAL) || (ret == PRESOLVED) || (ret == SUBOPTIMAL))
+    printf("%-16s %3d %24.16e %10.3e %10.3e\n", name, ret, get_objective(lp), residual(lp), seconds);
+  else
+    printf("%-16s %3d %24s %10s %10.3e\n", name, ret, "-", "-", seconds);
+  delete_lp(lp);
+  return( seconds );
+}
+
+int main(int argc, char *argv[])
+{
+  int    i, n, repeats = (argc > 1 ? atoi(argv[1]) : 1);
+  char   name[32], *ext;
+  lprec  *lp;
+  double total = 0;
+
+  if(repeats < 1)
+    repeats = 1;
+  for(i = 0; models[i] != NULL; i++) {
+    ext = strrchr(models[i], '.');
+    if((ext != NULL) && (strcmp(ext, ".mps") == 0)) {
+      lp = read_MPS(models[i], NEUTRAL);
+      if(lp == NULL)
+        lp = read_freeMPS(models[i], NEUTRAL);
+    }
+    else
+      lp = read_LP(models[i], NEUTRAL, "");
+    total += run(lp, models[i], repeats);
+  }
+  for(n = 3; n <= 9; n++) {
+    sprintf(name, "hilbert%d", n);
+    total += run(hilbert(n), name, repeats);
+  }
+  printf("%-16s %3s %24s %10s %10.3e\n", "total", "", "", "", total);
+  return( 0 );
+}
@@ -57,7 +57,8 @@ STATIC int prepareMDO(lprec *lp, MYBOOL *usedpos, int *colorder, int *data, int
    the row indexes of the non-zero values from the first call.  Note that the colamd() 
    row index base is 0 (which suits lp_solve fine). */
 {
-  int     i, ii, j, k, kk;
+  int     j, k, kk;
+  NZINDEX i, ii;
   int     nrows = lp->rows+1, ncols = colorder[0];
   int     offset = 0, Bnz = 0, Tnz;
   MYBOOL  dotally = (MYBOOL) (rowmap == NULL);
@@ -87,7 +88,7 @@ STATIC int prepareMDO(lprec *lp, MYBOOL *usedpos, int *colorder, int *data, int
       k = kk - lp->rows;
       i = mat->col_end[k-1];
       ii= mat->col_end[k];
-      Tnz += ii-i;
+      Tnz += (int) (ii-i);
 #ifdef Paranoia
       if(i >= ii)
         lp->report(lp, SEVERE, "prepareMDO: Encountered empty basic column %d\n", k);
@@ -12,6 +12,18 @@
     Release notes:
     v1.0.0  1 April   2004      First version.
     v1.1.0  20 July 2004        Reworked with flexible matrix storage model.
+    v1.2.0  16 October 2026     Added sifting crash for models with many more
+                                columns than rows.
+    v1.2.1  16 October 2026     Added Dantzig-Wolfe decomposition crash for
+                                block-angular models.
+    v1.2.2  16 October 2026     Added network simplex crash for pure network
+                                models.
+    v1.2.3  17 October 2026     Added Bixby and lower triangular sparse-first
+                                (LTSF) triangular crash bases.
+    v1.2.4  17 October 2026     Sparse guess_basis with linear-time selection
+                                and rank-revealing basis repair.
+    v1.2.5  17 October 2026     Reject degenerate block decompositions before
+                                the Dantzig-Wolfe crash.
 
    ----------------------------------------------------------------------------------
 */
@@ -24,6 +36,7 @@
 #include "lp_utils.h"
 #include "lp_report.h"
 #include "lp_matrix.h"
+#include "lp_price.h"
 #include "lp_crash.h"
 
 #ifdef FORTIFY
@@ -53,7 +66,8 @@ MYBOOL crash_basis(lprec *lp)
   if((lp->crashmode == CRASH_MOSTFEASIBLE) && mat_validate(mat)) {
     /* The logic here follows Maros */
     LLrec   *rowLL = NULL, *colLL = NULL;
-    int     ii, rx, cx, ix, nz;
+    int     ii, rx, cx, ix;
+    NZINDEX k, nz;
     REAL    wx, tx, *rowMAX = NULL, *colMAX = NULL;
     int     *rowNZ = NULL, *colNZ = NULL, *rowWT = NULL, *colWT = NULL;
     REAL    *value;
@@ -73,14 +87,14 @@ MYBOOL crash_basis(lprec *lp)
     rownr = &COL_MAT_ROWNR(0);
     colnr = &COL_MAT_COLNR(0);
     value = &COL_MAT_VALUE(0);
-    for(i = 0; i < nz;
-        i++, rownr += matRowColStep, colnr += matRowColStep, value += matValueStep) {
+    for(k = 0; k < nz;
+        k++, rownr += matRowColStep, colnr += matRowColStep, value += matValueStep) {
       rx = *rownr;
       cx = *colnr;
       wx = fabs(*value);
       rowNZ[rx]++;
       colNZ[cx]++;
-      if(i == 0) {
+      if(k == 0) {
         rowMAX[rx] = wx;
         colMAX[cx] = wx;
         colMAX[0]  = wx;
@@ -95,8 +109,8 @@ MYBOOL crash_basis(lprec *lp)
     rownr = &COL_MAT_ROWNR(0);
     colnr = &COL_MAT_COLNR(0);
     value = &COL_MAT_VALUE(0);
-    for(i = 0; i < nz;
-        i++, rownr += matRowColStep, colnr += matRowColStep, value += matValueStep) {
+    for(k = 0; k < nz;
+        k++, rownr += matRowColStep, colnr += matRowColStep, value += matValueStep) {
       rx = *rownr;
       cx = *colnr;
       wx = fabs(*value);
@@ -172,11 +186,11 @@ MYBOOL crash_basis(lprec *lp)
       /* Select column */
       cx = 0;
       wx = -lp->infinite;
-      for(ii = mat->row_end[rx-1]; ii < mat->row_end[rx]; ii++) {
+      for(k = mat->row_end[rx-1]; k < mat->row_end[rx]; k++) {
 
         /* Update NZ column counts for row selected above */
-        tx = fabs(ROW_MAT_VALUE(ii));
-        ix = ROW_MAT_COLNR(ii);
+        tx = fabs(ROW_MAT_VALUE(k));
+        ix = ROW_MAT_COLNR(k);
 #ifdef CRASH_SIMPLESCALE
         if(tx >= CRASH_THRESHOLD * colMAX[0])
 #else
@@ -187,7 +201,7 @@ MYBOOL crash_basis(lprec *lp)
           continue;
 
         /* Now do the test for best pivot */
-        tx = my_sign(lp->orig_obj[ix]) - my_sign(ROW_MAT_VALUE(ii));
+        tx = my_sign(lp->orig_obj[ix]) - my_sign(ROW_MAT_VALUE(k));
         tx = colWT[ix] + CRASH_WEIGHT*tx - CRASH_SPACER*colNZ[ix];
         if(tx > wx) {
           cx = ix;
@@ -199,11 +213,11 @@ MYBOOL crash_basis(lprec *lp)
       removeLink(colLL, cx);
 
       /* Update row NZ counts */
-      ii = mat->col_end[cx-1];
-      rownr = &COL_MAT_ROWNR(ii);
-      value = &COL_MAT_VALUE(ii);
-      for(; ii < mat->col_end[cx];
-          ii++, rownr += matRowColStep, value += matValueStep) {
+      k = mat->col_end[cx-1];
+      rownr = &COL_MAT_ROWNR(k);
+      value = &COL_MAT_VALUE(k);
+      for(; k < mat->col_end[cx];
+          k++, rownr += matRowColStep, value += matValueStep) {
         wx = fabs(*value);
         ix = *rownr;
 #ifdef CRASH_SIMPLESCALE
@@ -234,7 +248,8 @@ Finish:
   else if((lp->crashmode == CRASH_LEASTDEGENERATE) && mat_validate(mat)) {
     /* The logic here follows Maros */
     LLrec   *rowLL = NULL, *colLL = NULL;
-    int     ii, rx, cx, ix, nz, *merit = NULL;
+    int     rx, cx, ix, *merit = NULL;
+    NZINDEX ii, k, nz;
     REAL    *value, wx, hold, *rhs = NULL, *eta = NULL;
     int     *rownr, *colnr;
 
@@ -264,8 +279,8 @@ Finish:
       colnr = &COL_MAT_COLNR(0);
       ii = 0;
       MEMCLEAR(merit, lp->columns + 1);
-      for(i = 0; i < nz;
-          i++, rownr += matRowColStep, colnr += matRowColStep) {
+      for(k = 0; k < nz;
+          k++, rownr += matRowColStep, colnr += matRowColStep) {
         rx = *rownr;
         cx = *colnr;
         if(isActiveLink(colLL, cx) && (rhs[rx] != 0)) {
@@ -287,15 +302,15 @@ Finish:
       }
 
       /* Determine the best pivot row */
-      i = mat->col_end[cx-1];
+      k = mat->col_end[cx-1];
       nz = mat->col_end[cx];
-      rownr = &COL_MAT_ROWNR(i);
-      value = &COL_MAT_VALUE(i);
+      rownr = &COL_MAT_ROWNR(k);
+      value = &COL_MAT_VALUE(k);
       rx = 0;
       wx = 0;
       MEMCLEAR(eta, lp->rows + 1);
-      for(; i < nz;
-          i++, rownr += matRowColStep, value += matValueStep) {
+      for(; k < nz;
+          k++, rownr += matRowColStep, value += matValueStep) {
         ix = *rownr;
         hold = *value;
         eta[ix] = rhs[ix] / hold;
@@ -331,6 +346,287 @@ FinishLD:
     freeLink(&colLL);
 
   }
+
+  /* Construct an optimal basis by solving a sequence of reduced working models */
+  else if((lp->crashmode == CRASH_SIFTING) && mat_validate(mat))
+    ok = sift_basis(lp);
+
+  /* Construct a basis from a decomposition of a block-angular model */
+  else if((lp->crashmode == CRASH_DECOMPOSE) && mat_validate(mat))
+    ok = decompose_basis(lp);
+
+  /* Solve pure network models with the network simplex */
+  else if((lp->crashmode == CRASH_NETWORK) && mat_validate(mat))
+    ok = network_basis(lp);
+
+  /* Construct a triangular basis with Bixby's crash */
+  else if((lp->crashmode == CRASH_BIXBY) && mat_validate(mat))
+    ok = bixby_basis(lp);
+
+  /* Construct a lower triangular sparse-first basis */
+  else if((lp->crashmode == CRASH_LTSF) && mat_validate(mat))
+    ok = ltsf_basis(lp);
+
+  return( ok );
+}
+
+STATIC lprec *crash_workmodel(lprec *lp, int nrows, int *rowmap)
+/* Create an empty helper model over the given rows of lp (all if rowmap
+   is NULL) that inherits the main tolerances and simplex strategy */
+{
+  int   i, ii;
+  REAL  hold;
+  lprec *work = make_lp(nrows, 0);
+
+  if(work == NULL)
+    return( work );
+  set_verbose(work, NEUTRAL);
+  set_infinite(work, lp->infinite);
+  set_epspivot(work, lp->epspivot);
+  set_epsb(work, lp->epsprimal);
+  set_epsd(work, lp->epsdual);
+  set_simplextype(work, lp->simplex_strategy);
+  for(i = 1; i <= nrows; i++) {
+    ii = (rowmap == NULL ? i : rowmap[i]);
+    set_constr_type(work, i, get_constr_type(lp, ii));
+    set_rh(work, i, get_rh(lp, ii));
+    if((hold = get_rh_range(lp, ii)) < lp->infinite)
+      set_rh_range(work, i, hold);
+  }
+  return( work );
+}
+
+STATIC MYBOOL sift_addcolumn(lprec *lp, lprec *work, int colnr, REAL *colval, int *rowidx, int *colmap)
+{
+  int i, n = get_columnex(lp, colnr, colval, rowidx);
+
+  if(n < 0)
+    return( FALSE );
+
+  /* The working model is always a minimization */
+  if(is_maxim(lp))
+    for(i = 0; i < n; i++)
+      if(rowidx[i] == 0)
+        colval[i] = my_flipsign(colval[i]);
+
+  if(!add_columnex(work, n, colval, rowidx) ||
+     !set_bounds(work, work->columns, get_lowbo(lp, colnr), get_upbo(lp, colnr)))
+    return( FALSE );
+  colmap[work->columns] = colnr;
+  return( TRUE );
+}
+
+STATIC MYBOOL sift_basis(lprec *lp)
+/* Solve a sequence of working models over a subset of the columns; the excluded
+   columns are priced with the duals of each working solution and the most
+   attractive ones are added until none price out.  A pair of artificial columns
+   with a large cost per row keeps each working model feasible.  The final
+   working basis is then mapped onto the full model. */
+{
+  lprec  *work = NULL;
+  MATrec *mat = lp->matA;
+  int    i, j, k, n, pass, status = NOTRUN,
+         nrows = lp->rows, ncols = lp->columns,
+         *colmap = NULL, *rowidx = NULL, *order = NULL, *basis = NULL;
+  NZINDEX ix, ie;
+  REAL   hold, penalty, *cost = NULL, *colval = NULL, *score = NULL, *duals;
+  MYBOOL *inwork = NULL, isart, ok;
+
+  if((nrows == 0) || (ncols < CRASH_SIFTRATIO*nrows))
+    return( TRUE );
+
+  report(lp, NORMAL, "crash_basis: 'Sifting' basis crashing selected\n");
+
+  /* Create temporary arrays */
+  n = ncols + 2*nrows;
+  ok = allocINT(lp,  &colmap, n + 1, FALSE) &&
+       allocINT(lp,  &basis, nrows + n + 1, FALSE) &&
+       allocINT(lp,  &rowidx, nrows + 1, FALSE) &&
+       allocINT(lp,  &order, ncols + 1, FALSE) &&
+       allocREAL(lp, &colval, nrows + 1, FALSE) &&
+       allocREAL(lp, &cost, ncols + 1, FALSE) &&
+       allocREAL(lp, &score, ncols + 1, FALSE) &&
+       allocMYBOOL(lp, &inwork, ncols + 1, TRUE);
+  if(!ok)
+    goto Finish;
+
+  /* Get the minimization costs and always include the columns that
+     cannot be left out at a zero value */
+  penalty = 1;
+  for(j = 1; j <= ncols; j++) {
+    cost[j] = my_chsign(is_maxim(lp), get_mat(lp, 0, j));
+    SETMAX(penalty, fabs(cost[j]));
+    if(get_lowbo(lp, j) != 0)
+      inwork[j] = TRUE;
+  }
+  penalty *= CRASH_SIFTPENALTY;
+
+  /* Cover each row with the column having the lowest cost per unit of coefficient */
+  for(i = 1; i <= nrows; i++) {
+    rowidx[i] = 0;
+    colval[i] = lp->infinite;
+  }
+  for(j = 1; j <= ncols; j++) {
+    ie = mat->col_end[j];
+    for(ix = mat->col_end[j-1]; ix < ie; ix++) {
+      i = COL_MAT_ROWNR(ix);
+      if(i == 0)
+        continue;
+      hold = fabs(unscaled_mat(lp, COL_MAT_VALUE(ix), i, j));
+      if(hold < lp->epsvalue)
+        continue;
+      hold = cost[j] / hold;
+      if(hold < colval[i]) {
+        colval[i] = hold;
+        rowidx[i] = j;
+      }
+    }
+  }
+  for(i = 1; i <= nrows; i++)
+    if(rowidx[i] > 0)
+      inwork[rowidx[i]] = TRUE;
+
+  /* Fill up the working set with the cheapest remaining columns */
+  n = 0;
+  for(j = 1; j <= ncols; j++) {
+    if(inwork[j])
+      continue;
+    n++;
+    order[n] = j;
+    score[n] = cost[j];
+  }
+  qsortex(score+1, n, 0, sizeof(*score), FALSE, compareREAL, order+1, sizeof(*order));
+  k = CRASH_SIFTSIZE*nrows;
+  for(j = 1; j <= ncols; j++)
+    if(inwork[j])
+      k--;
+  for(i = 1; (i <= n) && (k > 0); i++, k--)
+    inwork[order[i]] = TRUE;
+
+  /* Create the working model with the artificial columns first */
+  work = crash_workmodel(lp, nrows, NULL);
+  if(work == NULL) {
+    ok = FALSE;
+    goto Finish;
+  }
+  for(i = 1; i <= nrows; i++) {
+    rowidx[0] = 0;
+    colval[0] = penalty;
+    rowidx[1] = i;
+    for(k = -1; k <= 1; k += 2) {
+      colval[1] = k;
+      add_columnex(work, 2, colval, rowidx);
+      colmap[work->columns] = -i;
+    }
+  }
+  for(j = 1; j <= ncols; j++)
+    if(inwork[j] && !sift_addcolumn(lp, work, j, colval, rowidx, colmap)) {
+      ok = FALSE;
+      goto Finish;
+    }
+
+  /* Do the sifting loop */
+  for(pass = 1; pass <= CRASH_SIFTMAXLOOP; pass++) {
+
+    status = solve(work);
+    if((status != OPTIMAL) || !get_ptr_sensitivity_rhs(work, &duals, NULL, NULL))
+      break;
+
+    /* Price the excluded columns with the working duals */
+    n = 0;
+    for(j = 1; j <= ncols; j++) {
+      if(inwork[j])
+        continue;
+      hold = cost[j];
+      ie = mat->col_end[j];
+      for(ix = mat->col_end[j-1]; ix < ie; ix++) {
+        i = COL_MAT_ROWNR(ix);
+        if(i == 0)
+          continue;
+        hold -= duals[i-1] * unscaled_mat(lp, my_chsign(is_chsign(lp, i), COL_MAT_VALUE(ix)), i, j);
+      }
+      if(hold < -lp->epsdual*(1 + fabs(cost[j]))) {
+        n++;
+        order[n] = j;
+        score[n] = hold;
+      }
+    }
+    report(lp, DETAILED, "sift_basis: Pass %d with %d working columns found %d attractive columns\n",
+                         pass, work->columns - 2*nrows, n);
+    if(n == 0)
+      break;
+
+    /* Add the most attractive columns */
+    qsortex(score+1, n, 0, sizeof(*score), FALSE, compareREAL, order+1, sizeof(*order));
+    SETMIN(n, nrows);
+    for(i = 1; i <= n; i++) {
+      j = order[i];
+      inwork[j] = TRUE;
+      if(!sift_addcolumn(lp, work, j, colval, rowidx, colmap)) {
+        ok = FALSE;
+        goto Finish;
+      }
+    }
+  }
+
+  /* Leave the default basis if the working model could not be solved */
+  if((status != OPTIMAL) || !get_basis(work, basis, TRUE)) {
+    report(lp, NORMAL, "crash_basis: Sifting stopped with status %d; using default basis\n", status);
+    goto Finish;
+  }
+  report(lp, NORMAL, "crash_basis: Sifting completed after %d passes using %d of %d columns\n",
+                     MIN(pass, CRASH_SIFTMAXLOOP), work->columns - 2*nrows, ncols);
+
+  /* Map the working basis to the full model; basic artificials are
+     represented by the slack of their row */
+  for(i = 1; i <= lp->sum; i++) {
+    lp->is_basic[i] = FALSE;
+    lp->is_lower[i] = TRUE;
+  }
+  n = nrows + work->columns;
+  k = 0;
+  for(i = 1; i <= n; i++) {
+    j = abs(basis[i]);
+    isart = FALSE;
+    if(j > nrows) {
+      j = colmap[j - nrows];
+      isart = (MYBOOL) (j < 0);
+      j = my_if(isart, -j, nrows + j);
+    }
+    if(lp->is_basic[j])
+      continue;
+    if(i <= nrows) {
+      lp->is_basic[j] = TRUE;
+      lp->var_basic[++k] = j;
+    }
+    else if(!isart && (basis[i] > 0))
+      lp->is_lower[j] = FALSE;
+  }
+
+  /* Complete the basis with slacks if artificials coincided */
+  for(i = 1; (i <= nrows) && (k < nrows); i++)
+    if(!lp->is_basic[i]) {
+      lp->is_basic[i] = TRUE;
+      lp->is_lower[i] = TRUE;
+      lp->var_basic[++k] = i;
+    }
+  lp->var_basic[0] = FALSE;
+  lp->basis_valid = TRUE;
+  set_action(&lp->spx_action, ACTION_REBASE | ACTION_REINVERT | ACTION_RECOMPUTE);
+
+  /* Clean up */
+Finish:
+  if(work != NULL)
+    delete_lp(work);
+  FREE(colmap);
+  FREE(basis);
+  FREE(rowidx);
+  FREE(order);
+  FREE(colval);
+  FREE(cost);
+  FREE(score);
+  FREE(inwork);
+
   return( ok );
 }
 
@@ -728,6 +1024,7 @@ Finish:
 }
 #endif
 
+#if 0
 MYBOOL __WINAPI guess_basis(lprec *lp, REAL *guessvector, int *basisvector)
 {
   MYBOOL *isnz = NULL, status = FALSE;
@@ -861,3 +1158,1455 @@ Finish:
 
   return( status );
 }
+#endif
+
+/* Order test for the basis selection; larger distances from the closest bound
+   come first, and ties are resolved in favour of the slacks */
+#define CRASH_GUESSBEFORE(w1, i1, w2, i2)  (((w1) > (w2)) || (((w1) == (w2)) && ((i1) < (i2))))
+
+STATIC void crash_selectlargest(int *item, REAL *weight, int size, int k)
+/* Partial quickselect of item[1..size] so that the k items with the largest
+   weights are moved to the first k positions; expected O(size) */
+{
+  int  lo = 1, hi = size, i, j, pivI, saveI;
+  REAL pivW, saveW;
+
+  while(hi > lo) {
+    i = (lo + hi) / 2;
+    pivW = weight[i];
+    pivI = item[i];
+    i = lo;
+    j = hi;
+    while(i <= j) {
+      while(CRASH_GUESSBEFORE(weight[i], item[i], pivW, pivI))
+        i++;
+      while(CRASH_GUESSBEFORE(pivW, pivI, weight[j], item[j]))
+        j--;
+      if(i <= j) {
+        saveI = item[i];
+        item[i] = item[j];
+        item[j] = saveI;
+        saveW = weight[i];
+        weight[i] = weight[j];
+        weight[j] = saveW;
+        i++;
+        j--;
+      }
+    }
+    if(k <= j)
+      hi = j;
+    else if(k >= i)
+      lo = i;
+    else
+      break;
+  }
+}
+
+STATIC int BFP_CALLMODEL crash_getbasiscolumn(lprec *lp, int varnr, REAL nzvalues[], int nzrows[], int mapin[])
+/* Column callback for bfp_findredundant; slacks are unit columns */
+{
+  int     n = 0;
+  NZINDEX i, ie;
+  MATrec  *mat = lp->matA;
+
+  if(varnr <= lp->rows) {
+    if(nzvalues != NULL) {
+      nzrows[0] = mapin[varnr];
+      nzvalues[0] = 1;
+    }
+    return( 1 );
+  }
+  varnr -= lp->rows;
+  ie = mat->col_end[varnr];
+  for(i = mat->col_end[varnr-1]; i < ie; i++, n++) {
+    if(nzvalues != NULL) {
+      nzrows[n] = mapin[COL_MAT_ROWNR(i)];
+      nzvalues[n] = COL_MAT_VALUE(i);
+    }
+  }
+  return( n );
+}
+
+MYBOOL __WINAPI guess_basis(lprec *lp, REAL *guessvector, int *basisvector)
+/* Sparse basis guess; the row activities are accumulated only over the columns
+   with a non-zero guess, the basic variables are the ones furthest from their
+   closest bound as picked by a linear-time selection, and the basis is finally
+   made non-singular with a single rank-revealing factorization, where the
+   dependent basic variables are exchanged for the slacks of the rank deficient
+   rows.  Non-basic constraints are coded as being at their "lower" bound when
+   they are closest to the right hand side of their internal (sign changed) form. */
+{
+  MYBOOL status = FALSE, *isbasic = NULL;
+  REAL   *values = NULL, *distance = NULL,
+         eps = lp->epsprimal, x, upB, loB;
+  int    i, j, k, n, nrows = lp->rows, ncols = lp->columns, nsum = lp->sum,
+         *maprow = NULL, *mapcol = NULL;
+  NZINDEX ix, ie;
+  MATrec *mat = lp->matA;
+
+  if(!mat_validate(mat))
+    return( status );
+
+  /* Create helper arrays */
+  if(!allocREAL(lp, &values, nsum+1, TRUE) ||
+     !allocREAL(lp, &distance, nsum+1, FALSE) ||
+     !allocMYBOOL(lp, &isbasic, nsum+1, TRUE))
+    goto Finish;
+
+  /* Compute the row activities, skipping the columns with a zero guess */
+  for(j = 1; j <= ncols; j++) {
+    x = guessvector[j];
+    values[nrows + j] = x;
+    if(x == 0)
+      continue;
+    ie = mat->col_end[j];
+    for(ix = mat->col_end[j-1]; ix < ie; ix++) {
+      k = COL_MAT_ROWNR(ix);
+      values[k] += unscaled_mat(lp, my_chsign(is_chsign(lp, k), COL_MAT_VALUE(ix)), k, j) * x;
+    }
+  }
+
+  /* Compute the distance from the closest bound; violations count as large
+     distances, and free variables get a zero distance */
+  for(i = 1; i <= nsum; i++) {
+    if(i <= nrows) {
+      loB = get_rh_lower(lp, i);
+      upB = get_rh_upper(lp, i);
+    }
+    else {
+      loB = get_lowbo(lp, i-nrows);
+      upB = get_upbo(lp, i-nrows);
+    }
+    x = values[i];
+    if(my_infinite(lp, loB) && my_infinite(lp, upB))
+      distance[i] = 0;
+    else if(x+eps < loB)
+      distance[i] = loB-x;
+    else if(x-eps > upB)
+      distance[i] = x-upB;
+    else if(my_infinite(lp, upB))
+      distance[i] = MAX(0, x-loB);
+    else if(my_infinite(lp, loB))
+      distance[i] = MAX(0, upB-x);
+    else
+      distance[i] = MAX(0, MIN(upB-x, x-loB));
+    basisvector[i] = i;
+  }
+
+  /* Select the basic variables in linear expected time */
+  crash_selectlargest(basisvector, distance, nsum, nrows);
+  for(i = 1; i <= nrows; i++)
+    isbasic[basisvector[i]] = TRUE;
+
+  /* Check the rank of the basis and replace any dependent basic variables
+     by the slacks of the rows that are not spanned */
+  if((nrows > 0) && (lp->bfp_findredundant != NULL) &&
+     allocINT(lp, &maprow, nrows+1, FALSE) &&
+     allocINT(lp, &mapcol, nrows+1, FALSE)) {
+    for(i = 1; i <= nrows; i++) {
+      maprow[i] = i;
+      mapcol[i] = basisvector[i];
+    }
+    mapcol[0] = nrows;
+    n = lp->bfp_findredundant(lp, nrows, crash_getbasiscolumn, maprow, mapcol);
+    if(n > 0) {
+      /* Columns dropped as empty and those after the rank are dependent */
+      for(i = 1; i <= nrows; i++)
+        isbasic[basisvector[i]] = FALSE;
+      for(i = 1; i <= nrows - n; i++)
+        isbasic[mapcol[i]] = TRUE;
+      for(i = 1; i <= n; i++)
+        isbasic[maprow[i]] = TRUE;
+      report(lp, NORMAL, "guess_basis: Replaced %d dependent basic variables by slacks\n", n);
+
+      /* Rebuild the basic and non-basic partitions of the index list */
+      k = 0;
+      for(i = 1; i <= nsum; i++)
+        if(isbasic[i])
+          basisvector[++k] = i;
+      for(i = 1; i <= nsum; i++)
+        if(!isbasic[i])
+          basisvector[++k] = i;
+    }
+  }
+
+  /* Code the non-basic variables by their closest bound, where the constraints
+     are at their "lower" bound when active at their internal right hand side */
+  for(i = nrows+1; i <= nsum; i++) {
+    j = basisvector[i];
+    x = values[j];
+    if(j <= nrows) {
+      if(is_chsign(lp, j)) {
+        loB = get_rh_lower(lp, j);
+        upB = get_rh_upper(lp, j);
+      }
+      else {
+        loB = -get_rh_upper(lp, j);
+        upB = -get_rh_lower(lp, j);
+        x = -x;
+      }
+    }
+    else {
+      loB = get_lowbo(lp, j-nrows);
+      upB = get_upbo(lp, j-nrows);
+    }
+    if(my_infinite(lp, upB) || (!my_infinite(lp, loB) && (x-loB <= upB-x)))
+      basisvector[i] = -j;
+  }
+
+  /* Lastly code all basic variables as lower-bounded */
+  for(i = 1; i <= nrows; i++)
+    basisvector[i] = -abs(basisvector[i]);
+
+  status = TRUE;
+
+  /* Clean up */
+Finish:
+  FREE(values);
+  FREE(distance);
+  FREE(isbasic);
+  FREE(maprow);
+  FREE(mapcol);
+
+  return( status );
+}
+
+STATIC int crash_findRoot(int *parent, int item)
+{
+  while(parent[item] != item) {
+    parent[item] = parent[parent[item]];
+    item = parent[item];
+  }
+  return( item );
+}
+
+STATIC int crash_findBlocks(lprec *lp, int *rowblock, int *colblock)
+/* Partition the columns into blocks that are only coupled through a set of
+   linking rows.  Rows spanning more columns than the block width estimated
+   by partial_findBlocks are taken as linking rows; the blocks are the
+   connected components of the remaining rows.  On return rowblock[i] is
+   0 for linking rows and -1 for empty rows, and colblock[j] is the block of
+   column j.  Returns the number of blocks. */
+{
+  int    i, j, n, nb, width, *parent = NULL, *label = NULL;
+  NZINDEX jj, je;
+  REAL   hold;
+  MATrec *mat = lp->matA;
+
+  if(!allocINT(lp, &parent, lp->columns+1, FALSE) ||
+     !allocINT(lp, &label, MAX(lp->rows, lp->columns)+1, TRUE)) {
+    FREE(parent);
+    return( 0 );
+  }
+  /* Get the block width from the partial pricing block estimate, or otherwise
+     from the largest relative jump in the sorted column spans of the rows */
+  nb = partial_findBlocks(lp, FALSE, FALSE);
+  if(nb > 1)
+    width = lp->columns / nb;
+  else {
+    n = 0;
+    for(i = 1; i <= lp->rows; i++) {
+      jj = mat->row_end[i-1];
+      je = mat->row_end[i];
+      if(jj < je)
+        label[++n] = ROW_MAT_COLNR(je-1) - ROW_MAT_COLNR(jj) + 1;
+    }
+    qsortex(label+1, n, 0, sizeof(*label), FALSE, compareINT, NULL, 0);
+    width = lp->columns;
+    hold = CRASH_DECOMPMINJUMP;
+    for(i = n-1; (i > 0) && (i >= n*(1-CRASH_DECOMPMAXLINK)); i--)
+      if(label[i+1] > hold*label[i]) {
+        hold = (REAL) label[i+1] / label[i];
+        width = label[i];
+      }
+    MEMCLEAR(label, lp->columns+1);
+    nb = lp->columns / width;
+  }
+
+  /* Merge the columns of each non-linking row */
+  for(j = 1; j <= lp->columns; j++) {
+    parent[j] = j;
+    colblock[j] = 0;
+  }
+  for(i = 1; i <= lp->rows; i++) {
+    jj = mat->row_end[i-1];
+    je = mat->row_end[i];
+    if(jj == je) {
+      rowblock[i] = -1;
+      continue;
+    }
+    if(ROW_MAT_COLNR(je-1) - ROW_MAT_COLNR(jj) >= width) {
+      rowblock[i] = 0;
+      continue;
+    }
+    rowblock[i] = 1;
+    n = crash_findRoot(parent, ROW_MAT_COLNR(jj));
+    for(; jj < je; jj++) {
+      j = ROW_MAT_COLNR(jj);
+      colblock[j] = 1;
+      j = crash_findRoot(parent, j);
+      parent[j] = n;
+    }
+  }
+
+  /* Number the components; columns that only appear in linking rows
+     are collected in a separate, final block */
+  n = 0;
+  for(j = 1; j <= lp->columns; j++) {
+    if(colblock[j] == 0)
+      continue;
+    i = crash_findRoot(parent, j);
+    if(label[i] == 0)
+      label[i] = ++n;
+    colblock[j] = label[i];
+  }
+  for(j = 1; j <= lp->columns; j++)
+    if(colblock[j] == 0) {
+      n++;
+      break;
+    }
+  for(; j <= lp->columns; j++)
+    if(colblock[j] == 0)
+      colblock[j] = n;
+
+  /* Combine components beyond the block limit */
+  if(n > CRASH_DECOMPMAXBLOCKS) {
+    for(j = 1; j <= lp->columns; j++)
+      colblock[j] = (colblock[j] - 1) % CRASH_DECOMPMAXBLOCKS + 1;
+    n = CRASH_DECOMPMAXBLOCKS;
+  }
+  for(i = 1; i <= lp->rows; i++)
+    if(rowblock[i] > 0)
+      rowblock[i] = colblock[ROW_MAT_COLNR(mat->row_end[i-1])];
+
+  FREE(parent);
+  FREE(label);
+  return( n );
+}
+
+STATIC MYBOOL decompose_basis(lprec *lp)
+/* Solve a block-angular model by Dantzig-Wolfe decomposition, with one
+   subproblem per block and a master problem over the linking rows, and set
+   a basis matching the recovered primal solution.  Decompositions without
+   linking rows or with a block of no rows or a single column are rejected. */
+{
+  lprec  *master = NULL, **sub = NULL;
+  MATrec *mat = lp->matA;
+  int    i, j, k, l, n, nb, nlink = 0, pass, added, status = NOTRUN,
+         nrows = lp->rows, ncols = lp->columns, nprop = 0, poolsize = 0, poolalloc = 0,
+         *rowblock = NULL, *colblock = NULL, *rowpos = NULL,
+         *rowlist = NULL, *rowstart = NULL, *collist = NULL, *colstart = NULL,
+         *propblock = NULL, *propstart = NULL, *rowidx = NULL, *basis = NULL;
+  NZINDEX ix, ie;
+  REAL   hold, value, penalty, *cost = NULL, *colval = NULL, *linkval = NULL,
+         *subobj = NULL, *pool = NULL, *x = NULL, *duals = NULL, *sens, *xsub, *lambda;
+  MYBOOL ok;
+
+  if(nrows == 0)
+    return( TRUE );
+
+  /* Identify the blocks */
+  ok = allocINT(lp, &rowblock, nrows + 1, FALSE) &&
+       allocINT(lp, &colblock, ncols + 1, FALSE);
+  if(!ok)
+    goto Finish;
+  nb = crash_findBlocks(lp, rowblock, colblock);
+  if(nb < 2) {
+    report(lp, NORMAL, "crash_basis: No block structure found for decomposition\n");
+    goto Finish;
+  }
+  for(i = 1; i <= nrows; i++)
+    if(rowblock[i] == 0)
+      nlink++;
+
+  /* Create the block index lists */
+  n = MAX(nrows, nlink + nb);
+  ok = allocINT(lp,  &rowpos, nrows + 1, FALSE) &&
+       allocINT(lp,  &rowlist, nrows + 1, FALSE) &&
+       allocINT(lp,  &rowstart, nb + 2, TRUE) &&
+       allocINT(lp,  &collist, ncols + 1, FALSE) &&
+       allocINT(lp,  &colstart, nb + 2, TRUE) &&
+       allocINT(lp,  &rowidx, n + 2, FALSE) &&
+       allocINT(lp,  &basis, lp->sum + 1, FALSE) &&
+       allocREAL(lp, &colval, n + 2, FALSE) &&
+       allocREAL(lp, &linkval, nlink + 1, TRUE) &&
+       allocREAL(lp, &cost, ncols + 1, FALSE) &&
+       allocREAL(lp, &subobj, ncols + 1, FALSE) &&
+       allocREAL(lp, &x, ncols + 1, TRUE);
+  if(!ok)
+    goto Finish;
+  for(i = 1; i <= nrows; i++)
+    if(rowblock[i] >= 0)
+      rowstart[rowblock[i]+1]++;
+  for(j = 1; j <= ncols; j++)
+    colstart[colblock[j]+1]++;
+  rowstart[0] = 1;
+  colstart[0] = 1;
+  for(k = 1; k <= nb+1; k++) {
+    rowstart[k] += rowstart[k-1];
+    colstart[k] += colstart[k-1];
+  }
+  for(i = 1; i <= nrows; i++)
+    if(rowblock[i] >= 0)
+      rowlist[rowstart[rowblock[i]]++] = i;
+  for(j = 1; j <= ncols; j++)
+    collist[colstart[colblock[j]]++] = j;
+  for(k = nb+1; k > 0; k--) {
+    rowstart[k] = rowstart[k-1];
+    colstart[k] = colstart[k-1];
+  }
+  rowstart[0] = 1;
+  colstart[0] = 1;
+  for(k = 0; k <= nb; k++)
+    for(l = rowstart[k]; l < rowstart[k+1]; l++)
+      rowpos[rowlist[l]] = l - rowstart[k] + 1;
+
+  /* Reject degenerate decompositions; without linking rows the blocks are
+     not coupled, and a block without rows or with a single column, such as
+     the empty columns of an otherwise connected model, is no real block */
+  for(k = 1; k <= nb; k++)
+    if((rowstart[k+1] == rowstart[k]) || (colstart[k+1] - colstart[k] < 2))
+      break;
+  if((nlink == 0) || (k <= nb)) {
+    report(lp, NORMAL, "crash_basis: Degenerate decomposition into %d blocks with %d linking rows rejected\n",
+                       nb, nlink);
+    goto Finish;
+  }
+  report(lp, NORMAL, "crash_basis: Decomposition into %d blocks with %d linking rows selected\n",
+                     nb, nlink);
+
+  /* Get the minimization costs */
+  penalty = 1;
+  for(j = 1; j <= ncols; j++) {
+    cost[j] = my_chsign(is_maxim(lp), get_mat(lp, 0, j));
+    SETMAX(penalty, fabs(cost[j]));
+  }
+  penalty *= CRASH_SIFTPENALTY;
+
+  /* Create the subproblems */
+  sub = (lprec **) calloc(nb + 1, sizeof(*sub));
+  ok = (MYBOOL) (sub != NULL);
+  for(k = 1; ok && (k <= nb); k++) {
+    sub[k] = crash_workmodel(lp, rowstart[k+1] - rowstart[k], rowlist + rowstart[k] - 1);
+    ok = (MYBOOL) (sub[k] != NULL);
+    for(l = colstart[k]; ok && (l < colstart[k+1]); l++) {
+      j = collist[l];
+      n = 0;
+      ie = mat->col_end[j];
+      for(ix = mat->col_end[j-1]; ix < ie; ix++) {
+        if(rowblock[COL_MAT_ROWNR(ix)] != k)
+          continue;
+        rowidx[n] = rowpos[COL_MAT_ROWNR(ix)];
+        colval[n] = unscaled_mat(lp, my_chsign(is_chsign(lp, COL_MAT_ROWNR(ix)), COL_MAT_VALUE(ix)),
+                                     COL_MAT_ROWNR(ix), j);
+        n++;
+      }
+      ok = add_columnex(sub[k], n, colval, rowidx) &&
+           set_bounds(sub[k], sub[k]->columns, get_lowbo(lp, j), get_upbo(lp, j));
+    }
+  }
+  if(!ok)
+    goto Finish;
+
+  /* Create the master problem with the linking rows, convexity rows and
+     a pair of artificial columns per linking row */
+  master = crash_workmodel(lp, nlink, rowlist);
+  ok = (MYBOOL) (master != NULL);
+  for(k = 1; ok && (k <= nb); k++)
+    ok = add_constraintex(master, 0, NULL, NULL, EQ, 1);
+  for(i = 1; ok && (i <= nlink); i++) {
+    rowidx[0] = 0;
+    colval[0] = penalty;
+    rowidx[1] = i;
+    for(k = -1; ok && (k <= 1); k += 2) {
+      colval[1] = k;
+      ok = add_columnex(master, 2, colval, rowidx);
+    }
+  }
+  if(!ok)
+    goto Finish;
+
+  /* Do the column generation loop */
+  for(pass = 0; pass <= CRASH_DECOMPMAXLOOP; pass++) {
+
+    if(pass > 0) {
+      status = solve(master);
+      if((status != OPTIMAL) || !get_ptr_sensitivity_rhs(master, &sens, NULL, NULL))
+        break;
+
+      /* Keep a copy, since adding proposals to the master frees its duals */
+      if((duals == NULL) && !allocREAL(lp, &duals, nlink + nb, FALSE)) {
+        ok = FALSE;
+        goto Finish;
+      }
+      MEMCOPY(duals, sens, nlink + nb);
+      if(pass == CRASH_DECOMPMAXLOOP)
+        break;
+    }
+
+    added = 0;
+    for(k = 1; k <= nb; k++) {
+
+      /* Price the linking rows into the subproblem objective */
+      for(l = colstart[k]; l < colstart[k+1]; l++) {
+        j = collist[l];
+        hold = cost[j];
+        if(duals != NULL) {
+          ie = mat->col_end[j];
+          for(ix = mat->col_end[j-1]; ix < ie; ix++) {
+            n = COL_MAT_ROWNR(ix);
+            if((n == 0) || (rowblock[n] != 0))
+              continue;
+            hold -= duals[rowpos[n]-1] *
+                    unscaled_mat(lp, my_chsign(is_chsign(lp, n), COL_MAT_VALUE(ix)), n, j);
+          }
+        }
+        subobj[l - colstart[k] + 1] = hold;
+      }
+      set_obj_fnex(sub[k], sub[k]->columns, subobj, NULL);
+      status = solve(sub[k]);
+      if(status != OPTIMAL)
+        break;
+      value = get_objective(sub[k]);
+      if((duals != NULL) &&
+         (value - duals[nlink+k-1] >= -lp->epsdual*(1 + fabs(value))))
+        continue;
+
+      /* Store the proposal and add it to the master problem */
+      get_ptr_variables(sub[k], &xsub);
+      n = sub[k]->columns;
+      ok = allocINT(lp, &propblock, nprop + 2, AUTOMATIC) &&
+           allocINT(lp, &propstart, nprop + 2, AUTOMATIC);
+      if(ok && (poolsize + n > poolalloc)) {
+        poolalloc = 2*(poolsize + n);
+        ok = allocREAL(lp, &pool, poolalloc, AUTOMATIC);
+      }
+      if(!ok)
+        goto Finish;
+      nprop++;
+      propblock[nprop] = k;
+      propstart[nprop] = poolsize;
+      MEMCOPY(pool + poolsize, xsub, n);
+      poolsize += n;
+
+      hold = 0;
+      for(l = colstart[k]; l < colstart[k+1]; l++) {
+        j = collist[l];
+        value = xsub[l - colstart[k]];
+        if(value == 0)
+          continue;
+        hold += cost[j] * value;
+        ie = mat->col_end[j];
+        for(ix = mat->col_end[j-1]; ix < ie; ix++) {
+          n = COL_MAT_ROWNR(ix);
+          if((n == 0) || (rowblock[n] != 0))
+            continue;
+          linkval[rowpos[n]] += value *
+                    unscaled_mat(lp, my_chsign(is_chsign(lp, n), COL_MAT_VALUE(ix)), n, j);
+        }
+      }
+      rowidx[0] = 0;
+      colval[0] = hold;
+      n = 1;
+      for(i = 1; i <= nlink; i++) {
+        if(linkval[i] != 0) {
+          rowidx[n] = i;
+          colval[n] = linkval[i];
+          n++;
+        }
+        linkval[i] = 0;
+      }
+      rowidx[n] = nlink + k;
+      colval[n] = 1;
+      n++;
+      if(!add_columnex(master, n, colval, rowidx)) {
+        ok = FALSE;
+        goto Finish;
+      }
+      added++;
+    }
+    if(status != OPTIMAL)
+      break;
+    report(lp, DETAILED, "decompose_basis: Pass %d added %d proposals\n", pass, added);
+    if((pass > 0) && (added == 0))
+      break;
+  }
+  if(status != OPTIMAL) {
+    report(lp, NORMAL, "crash_basis: Decomposition stopped with status %d; using default basis\n",
+                       status);
+    goto Finish;
+  }
+
+  /* Recover the primal solution as a convex combination of the proposals
+     and guess a basis for it */
+  get_ptr_variables(master, &lambda);
+  hold = 0;
+  for(i = 0; i < 2*nlink; i++)
+    hold += lambda[i];
+  if(hold > lp->epsprimal)
+    report(lp, NORMAL, "crash_basis: Decomposition left linking rows infeasible by %g\n", hold);
+  for(i = 1; i <= nprop; i++) {
+    value = lambda[2*nlink + i - 1];
+    if(value == 0)
+      continue;
+    k = propblock[i];
+    xsub = pool + propstart[i];
+    for(l = colstart[k]; l < colstart[k+1]; l++)
+      x[collist[l]] += value * xsub[l - colstart[k]];
+  }
+  if(!guess_basis(lp, x, basis))
+    report(lp, DETAILED, "decompose_basis: Recovered solution is not feasible\n");
+  for(i = 1; i <= lp->sum; i++) {
+    lp->is_basic[i] = FALSE;
+    lp->is_lower[i] = TRUE;
+  }
+  for(i = 1; i <= lp->sum; i++) {
+    j = abs(basis[i]);
+    if(i <= nrows) {
+      lp->is_basic[j] = TRUE;
+      lp->var_basic[i] = j;
+    }
+    /* Slacks made nonbasic by the rank repair need not be at a finite bound */
+    else if((basis[i] > 0) && !my_infinite(lp, lp->orig_upbo[j]))
+      lp->is_lower[j] = FALSE;
+  }
+  report(lp, NORMAL, "crash_basis: Decomposition completed after %d passes with %d proposals\n",
+                     pass, nprop);
+  lp->var_basic[0] = FALSE;
+  lp->basis_valid = TRUE;
+  set_action(&lp->spx_action, ACTION_REBASE | ACTION_REINVERT | ACTION_RECOMPUTE);
+
+  /* Clean up */
+Finish:
+  if(sub != NULL) {
+    for(k = 1; k <= nb; k++)
+      if(sub[k] != NULL)
+        delete_lp(sub[k]);
+    free(sub);
+  }
+  if(master != NULL)
+    delete_lp(master);
+  FREE(rowblock);
+  FREE(colblock);
+  FREE(rowpos);
+  FREE(rowlist);
+  FREE(rowstart);
+  FREE(collist);
+  FREE(colstart);
+  FREE(propblock);
+  FREE(propstart);
+  FREE(rowidx);
+  FREE(basis);
+  FREE(colval);
+  FREE(linkval);
+  FREE(cost);
+  FREE(subobj);
+  FREE(pool);
+  FREE(x);
+  FREE(duals);
+
+  return( ok );
+}
+
+STATIC MYBOOL net_findEntering(netrec *net)
+/* Block search pricing; scan blocks of arcs from where the previous
+   search stopped and take the most negative reduced cost of a block */
+{
+  int  e, k, cnt, min_arc = -1;
+  REAL c, min = -net->epsvalue;
+
+  cnt = net->blocksize;
+  for(k = 0, e = net->nextarc; k < net->arcs; k++, e++) {
+    if(e == net->arcs)
+      e = 0;
+    c = net->state[e] * (net->cost[e] + net->pi[net->source[e]] - net->pi[net->target[e]]);
+    if(c < min) {
+      min = c;
+      min_arc = e;
+    }
+    if((--cnt == 0) || (k == net->arcs-1)) {
+      if(min_arc >= 0) {
+        net->inarc = min_arc;
+        net->nextarc = e + 1;
+        if(net->nextarc == net->arcs)
+          net->nextarc = 0;
+        return( TRUE );
+      }
+      cnt = net->blocksize;
+    }
+  }
+  return( FALSE );
+}
+
+STATIC int net_findLeaving(netrec *net)
+/* Find the join node of the cycle closed by the entering arc and the blocking
+   arc; the last blocking arc in the cycle orientation keeps the tree strongly
+   feasible.  Returns 0 if the entering arc itself is blocking. */
+{
+  int  u, v, e, first, second, result = 0;
+  REAL d;
+
+  u = net->source[net->inarc];
+  v = net->target[net->inarc];
+  while(u != v) {
+    if(net->succnum[u] < net->succnum[v])
+      u = net->parent[u];
+    else
+      v = net->parent[v];
+  }
+  net->joinnode = u;
+
+  if(net->state[net->inarc] == 1) {
+    first  = net->source[net->inarc];
+    second = net->target[net->inarc];
+  }
+  else {
+    first  = net->target[net->inarc];
+    second = net->source[net->inarc];
+  }
+  net->delta = net->cap[net->inarc];
+
+  for(u = first; u != net->joinnode; u = net->parent[u]) {
+    e = net->pred[u];
+    d = net->flow[e];
+    if(net->preddir[u] < 0)
+      d = (net->cap[e] >= net->infinity ? net->infinity : net->cap[e] - d);
+    if(d < net->delta) {
+      net->delta = d;
+      net->uout = u;
+      result = 1;
+    }
+  }
+  for(u = second; u != net->joinnode; u = net->parent[u]) {
+    e = net->pred[u];
+    d = net->flow[e];
+    if(net->preddir[u] > 0)
+      d = (net->cap[e] >= net->infinity ? net->infinity : net->cap[e] - d);
+    if(d <= net->delta) {
+      net->delta = d;
+      net->uout = u;
+      result = 2;
+    }
+  }
+  if(result == 1) {
+    net->uin = first;
+    net->vin = second;
+  }
+  else {
+    net->uin = second;
+    net->vin = first;
+  }
+  return( result );
+}
+
+STATIC void net_changeFlow(netrec *net, int result)
+{
+  int  u, e;
+  REAL val;
+
+  if(net->delta > 0) {
+    val = net->state[net->inarc] * net->delta;
+    net->flow[net->inarc] += val;
+    for(u = net->source[net->inarc]; u != net->joinnode; u = net->parent[u])
+      net->flow[net->pred[u]] -= net->preddir[u] * val;
+    for(u = net->target[net->inarc]; u != net->joinnode; u = net->parent[u])
+      net->flow[net->pred[u]] += net->preddir[u] * val;
+  }
+  if(result == 0) {
+    net->state[net->inarc] = -net->state[net->inarc];
+    net->flow[net->inarc] = (net->state[net->inarc] > 0 ? 0 : net->cap[net->inarc]);
+    return;
+  }
+
+  /* The leaving arc goes to the bound that was reached */
+  net->state[net->inarc] = 0;
+  u = net->uout;
+  e = net->pred[u];
+  if((result == 1) == (net->preddir[u] > 0)) {
+    net->state[e] = 1;
+    net->flow[e] = 0;
+  }
+  else {
+    net->state[e] = -1;
+    net->flow[e] = net->cap[e];
+  }
+}
+
+STATIC void net_updateTree(netrec *net)
+/* Hang the subtree cut off by the leaving arc below the entering arc, updating
+   the parent, thread, successor count and last successor indices along the
+   stem; then shift the potentials of the moved subtree */
+{
+  int  u, p, stem, par_stem, next_stem, last, before, after, thread_continue,
+       ndirty = 0, tmp_sc, tmp_ls, up_limit_out, last_succ_out,
+       uin = net->uin, vin = net->vin, uout = net->uout, vout, joinnode = net->joinnode,
+       old_rev_thread = net->revthread[uout],
+       old_succ_num = net->succnum[uout],
+       old_last_succ = net->lastsucc[uout];
+  int  *parent = net->parent, *thread = net->thread, *revthread = net->revthread,
+       *succnum = net->succnum, *lastsucc = net->lastsucc;
+  REAL sigma;
+
+  vout = parent[uout];
+  if(uin == uout) {
+    parent[uin] = vin;
+    net->pred[uin] = net->inarc;
+    net->preddir[uin] = (uin == net->source[net->inarc] ? 1 : -1);
+    if(thread[vin] != uout) {
+      after = thread[old_last_succ];
+      thread[old_rev_thread] = after;
+      revthread[after] = old_rev_thread;
+      after = thread[vin];
+      thread[vin] = uout;
+      revthread[uout] = vin;
+      thread[old_last_succ] = after;
+      revthread[after] = old_last_succ;
+    }
+  }
+  else {
+    thread_continue = (old_rev_thread == vin ? thread[old_last_succ] : thread[vin]);
+
+    /* Move the stem nodes between uin and uout, reversing their parent links */
+    stem = uin;
+    par_stem = vin;
+    last = lastsucc[uin];
+    after = thread[last];
+    thread[vin] = uin;
+    net->dirty[ndirty++] = vin;
+    while(stem != uout) {
+      next_stem = parent[stem];
+      thread[last] = next_stem;
+      net->dirty[ndirty++] = last;
+      before = revthread[stem];
+      thread[before] = after;
+      revthread[after] = before;
+      parent[stem] = par_stem;
+      par_stem = stem;
+      stem = next_stem;
+      last = (lastsucc[stem] == lastsucc[par_stem] ? revthread[par_stem] : lastsucc[stem]);
+      after = thread[last];
+    }
+    parent[uout] = par_stem;
+    thread[last] = thread_continue;
+    revthread[thread_continue] = last;
+    lastsucc[uout] = last;
+    if(old_rev_thread != vin) {
+      thread[old_rev_thread] = after;
+      revthread[after] = old_rev_thread;
+    }
+    for(u = 0; u < ndirty; u++)
+      revthread[thread[net->dirty[u]]] = net->dirty[u];
+
+    tmp_sc = 0;
+    tmp_ls = lastsucc[uout];
+    for(u = uout, p = parent[u]; u != uin; u = p, p = parent[u]) {
+      net->pred[u] = net->pred[p];
+      net->preddir[u] = -net->preddir[p];
+      tmp_sc += succnum[u] - succnum[p];
+      succnum[u] = tmp_sc;
+      lastsucc[p] = tmp_ls;
+    }
+    net->pred[uin] = net->inarc;
+    net->preddir[uin] = (uin == net->source[net->inarc] ? 1 : -1);
+    succnum[uin] = old_succ_num;
+  }
+
+  /* Update the last successors and successor counts up to the join node */
+  up_limit_out = (lastsucc[joinnode] == vin ? joinnode : -1);
+  last_succ_out = lastsucc[uout];
+  for(u = vin; (u != -1) && (lastsucc[u] == vin); u = parent[u])
+    lastsucc[u] = last_succ_out;
+  if((joinnode != old_rev_thread) && (vin != old_rev_thread)) {
+    for(u = vout; (u != up_limit_out) && (lastsucc[u] == old_last_succ); u = parent[u])
+      lastsucc[u] = old_rev_thread;
+  }
+  else if(last_succ_out != old_last_succ) {
+    for(u = vout; (u != up_limit_out) && (lastsucc[u] == old_last_succ); u = parent[u])
+      lastsucc[u] = last_succ_out;
+  }
+  for(u = vin; u != joinnode; u = parent[u])
+    succnum[u] += old_succ_num;
+  for(u = vout; u != joinnode; u = parent[u])
+    succnum[u] -= old_succ_num;
+
+  /* Shift the potentials of the moved subtree */
+  sigma = net->pi[vin] - net->pi[uin] - net->preddir[uin] * net->cost[net->inarc];
+  p = thread[lastsucc[uin]];
+  for(u = uin; u != p; u = thread[u])
+    net->pi[u] += sigma;
+}
+
+STATIC MYBOOL network_basis(lprec *lp)
+/* Detect a pure network model, where every column has at most a +1 and a -1
+   entry, and solve it with a primal network simplex on a spanning tree basis.
+   Each row is a node with its slack as an arc to node 0, which acts as the
+   ground node; columns with a single entry are also arcs to node 0.  The
+   optimal tree is mapped to an optimal basis of the lprec.  The regular
+   simplex can still need some iterations, since a degenerate tree may keep
+   the zero-capacity slack arc of an equality or zero-range row basic, and
+   such fixed basic variables are pivoted out.  Returns FALSE only on memory
+   failure; models that are not networks keep the current basis. */
+{
+  netrec  net;
+  MATrec  *mat = lp->matA;
+  int     i, j, k, e, n, ncols = lp->columns, nrows = lp->rows, result;
+  NZINDEX ix, ib, ie;
+  REAL    hold, value, lobo, upbo, maxcost = 0, eps = lp->epsprimal;
+  MYBOOL  ok = TRUE, *atupper = NULL;
+  double  pivots, maxpivots;
+
+  if(nrows == 0)
+    return( ok );
+
+  /* Check the matrix structure before allocating anything */
+  for(j = 1; j <= ncols; j++) {
+    ib = mat->col_end[j-1];
+    ie = mat->col_end[j];
+    if(ie - ib > 2)
+      return( ok );
+    for(ix = ib; ix < ie; ix++) {
+      value = unscaled_mat(lp, COL_MAT_VALUE(ix), COL_MAT_ROWNR(ix), j);
+      if(fabs(fabs(value) - 1) > lp->epsvalue)
+        return( ok );
+    }
+    if((ie - ib == 2) &&
+       (my_chsign(is_chsign(lp, COL_MAT_ROWNR(ib)), COL_MAT_VALUE(ib)) *
+        my_chsign(is_chsign(lp, COL_MAT_ROWNR(ib+1)), COL_MAT_VALUE(ib+1)) > 0))
+      return( ok );
+    if(get_lowbo(lp, j) < 0)
+      return( ok );
+  }
+  for(i = 1; i <= nrows; i++)
+    if(my_infinite(lp, my_if(is_chsign(lp, i), get_rh_lower(lp, i), get_rh_upper(lp, i))))
+      return( ok );
+
+  /* Allocate the network; the real arcs are the non-empty columns and the
+     row slacks, followed by one artificial arc per node */
+  MEMCLEAR(&net, 1);
+  net.nodes = nrows + 1;
+  net.root = net.nodes;
+  net.arcs = nrows;
+  for(j = 1; j <= ncols; j++)
+    if(mat->col_end[j] > mat->col_end[j-1])
+      net.arcs++;
+  n = net.arcs + net.nodes;
+  ok = allocINT(lp,  &net.source, n, FALSE) &&
+       allocINT(lp,  &net.target, n, FALSE) &&
+       allocINT(lp,  &net.varnr, n, FALSE) &&
+       allocINT(lp,  &net.state, n, FALSE) &&
+       allocREAL(lp, &net.cost, n, FALSE) &&
+       allocREAL(lp, &net.cap, n, FALSE) &&
+       allocREAL(lp, &net.flow, n, TRUE) &&
+       allocINT(lp,  &net.parent, net.nodes + 1, FALSE) &&
+       allocINT(lp,  &net.pred, net.nodes + 1, FALSE) &&
+       allocINT(lp,  &net.preddir, net.nodes + 1, FALSE) &&
+       allocINT(lp,  &net.thread, net.nodes + 1, FALSE) &&
+       allocINT(lp,  &net.revthread, net.nodes + 1, FALSE) &&
+       allocINT(lp,  &net.succnum, net.nodes + 1, FALSE) &&
+       allocINT(lp,  &net.lastsucc, net.nodes + 1, FALSE) &&
+       allocINT(lp,  &net.dirty, net.nodes + 1, FALSE) &&
+       allocREAL(lp, &net.supply, net.nodes + 1, TRUE) &&
+       allocREAL(lp, &net.pi, net.nodes + 1, FALSE) &&
+       allocMYBOOL(lp, &atupper, ncols + 1, TRUE);
+  if(!ok)
+    goto Finish;
+  net.infinity = lp->infinite;
+  net.epsvalue = lp->epsdual;
+
+  /* Set up the row slack arcs; the slack is zero at the upper bound of a
+     row and at the lower bound of a sign-changed row */
+  for(i = 1; i <= nrows; i++) {
+    e = i - 1;
+    lobo = get_rh_lower(lp, i);
+    upbo = get_rh_upper(lp, i);
+    if(is_chsign(lp, i)) {
+      net.source[e] = 0;
+      net.target[e] = i;
+      hold = lobo;
+    }
+    else {
+      net.source[e] = i;
+      net.target[e] = 0;
+      hold = upbo;
+    }
+    net.varnr[e] = i;
+    net.cost[e] = 0;
+    net.cap[e] = (my_infinite(lp, lobo) || my_infinite(lp, upbo) ? lp->infinite : upbo - lobo);
+    net.supply[i] += hold;
+    net.supply[0] -= hold;
+  }
+
+  /* Set up the column arcs with the lower bounds shifted to zero */
+  e = nrows;
+  for(j = 1; j <= ncols; j++) {
+    hold = my_chsign(is_maxim(lp), get_mat(lp, 0, j));
+    lobo = get_lowbo(lp, j);
+    upbo = get_upbo(lp, j);
+    ix = mat->col_end[j-1];
+    ie = mat->col_end[j];
+
+    /* Empty columns are simply placed at their cheapest bound */
+    if(ix == ie) {
+      if(hold < 0) {
+        if(my_infinite(lp, upbo))
+          goto Finish;
+        atupper[j] = TRUE;
+      }
+      continue;
+    }
+    net.source[e] = 0;
+    net.target[e] = 0;
+    for(; ix < ie; ix++) {
+      if(my_chsign(is_chsign(lp, COL_MAT_ROWNR(ix)), COL_MAT_VALUE(ix)) > 0)
+        net.source[e] = COL_MAT_ROWNR(ix);
+      else
+        net.target[e] = COL_MAT_ROWNR(ix);
+    }
+    net.varnr[e] = nrows + j;
+    net.cost[e] = hold;
+    SETMAX(maxcost, fabs(hold));
+    net.cap[e] = (my_infinite(lp, upbo) ? lp->infinite : upbo - lobo);
+    net.supply[net.source[e]] -= lobo;
+    net.supply[net.target[e]] += lobo;
+    e++;
+  }
+
+  /* Create the initial tree of artificial arcs from the root */
+  maxcost = (maxcost + 1) * (net.nodes + 1);
+  net.parent[net.root] = -1;
+  net.pred[net.root] = -1;
+  net.thread[net.root] = 0;
+  net.revthread[0] = net.root;
+  net.succnum[net.root] = net.nodes + 1;
+  net.lastsucc[net.root] = net.root - 1;
+  net.supply[net.root] = 0;
+  net.pi[net.root] = 0;
+  for(e = 0; e < net.arcs; e++) {
+    net.state[e] = 1;
+    net.flow[e] = 0;
+  }
+  for(i = 0; i < net.nodes; i++) {
+    e = net.arcs + i;
+    net.parent[i] = net.root;
+    net.pred[i] = e;
+    net.thread[i] = i + 1;
+    net.revthread[i + 1] = i;
+    net.succnum[i] = 1;
+    net.lastsucc[i] = i;
+    net.state[e] = 0;
+    net.cap[e] = lp->infinite;
+    net.cost[e] = maxcost;
+    net.varnr[e] = 0;
+    if(net.supply[i] >= 0) {
+      net.preddir[i] = 1;
+      net.pi[i] = -maxcost;
+      net.source[e] = i;
+      net.target[e] = net.root;
+      net.flow[e] = net.supply[i];
+    }
+    else {
+      net.preddir[i] = -1;
+      net.pi[i] = maxcost;
+      net.source[e] = net.root;
+      net.target[e] = i;
+      net.flow[e] = -net.supply[i];
+    }
+  }
+  net.blocksize = MAX((int) (CRASH_NETBLOCKSIZE * sqrt((double) net.arcs)), CRASH_NETMINBLOCK);
+  net.nextarc = 0;
+
+  /* Do the network simplex iterations */
+  maxpivots = (double) CRASH_NETMAXPIVOTS * (net.arcs + net.nodes);
+  for(pivots = 0; (pivots < maxpivots) && net_findEntering(&net); pivots++) {
+    result = net_findLeaving(&net);
+    if(net.delta >= net.infinity) {
+      report(lp, NORMAL, "crash_basis: Network model is unbounded; using default basis\n");
+      goto Finish;
+    }
+    net_changeFlow(&net, result);
+    if(result != 0)
+      net_updateTree(&net);
+    if((pivots > 0) && (fmod(pivots, 1000) == 0) && userabort(lp, -1))
+      goto Finish;
+  }
+  if(pivots >= maxpivots) {
+    report(lp, NORMAL, "crash_basis: Network simplex pivot limit reached; using default basis\n");
+    goto Finish;
+  }
+  for(i = 0; i < net.nodes; i++)
+    if(net.flow[net.arcs + i] > eps) {
+      report(lp, NORMAL, "crash_basis: Network model is infeasible; using default basis\n");
+      goto Finish;
+    }
+  report(lp, NORMAL, "crash_basis: Network simplex solved %d nodes and %d arcs in %.0f pivots\n",
+                     net.nodes, net.arcs, pivots);
+
+  /* Map the tree arcs to the basis, and the arcs at capacity to variables
+     at their upper bounds */
+  for(i = 1; i <= lp->sum; i++) {
+    lp->is_basic[i] = FALSE;
+    lp->is_lower[i] = TRUE;
+  }
+  for(j = 1; j <= ncols; j++)
+    if(atupper[j])
+      lp->is_lower[nrows + j] = FALSE;
+  n = 0;
+  for(e = 0; e < net.arcs; e++) {
+    k = net.varnr[e];
+    if(net.state[e] == 0) {
+      lp->is_basic[k] = TRUE;
+      lp->var_basic[++n] = k;
+    }
+    else if(net.state[e] < 0)
+      lp->is_lower[k] = FALSE;
+  }
+
+  /* Complete the basis with the slack of the top node of each subtree that
+     hangs off the root through a degenerate artificial arc, except for the
+     subtree of the ground node */
+  for(k = 0; net.parent[k] != net.root; k = net.parent[k]);
+  for(i = 1; (i <= nrows) && (n < nrows); i++)
+    if((net.parent[i] == net.root) && (i != k)) {
+      lp->is_basic[i] = TRUE;
+      lp->is_lower[i] = TRUE;
+      lp->var_basic[++n] = i;
+    }
+  lp->var_basic[0] = FALSE;
+  lp->basis_valid = TRUE;
+  set_action(&lp->spx_action, ACTION_REBASE | ACTION_REINVERT | ACTION_RECOMPUTE);
+
+  /* Clean up */
+Finish:
+  FREE(net.source);
+  FREE(net.target);
+  FREE(net.varnr);
+  FREE(net.state);
+  FREE(net.cost);
+  FREE(net.cap);
+  FREE(net.flow);
+  FREE(net.parent);
+  FREE(net.pred);
+  FREE(net.preddir);
+  FREE(net.thread);
+  FREE(net.revthread);
+  FREE(net.succnum);
+  FREE(net.lastsucc);
+  FREE(net.dirty);
+  FREE(net.supply);
+  FREE(net.pi);
+  FREE(atupper);
+
+  return( ok );
+}
+
+STATIC MYBOOL bixby_basis(lprec *lp)
+/* Bixby's crash (ORSA J. on Computing 4, 1992): starting from the slack
+   basis, the artificial slacks of the equality rows are replaced by
+   structural columns taken in order of preference; free columns first,
+   then one-sided and finally boxed columns, and within each class by
+   ascending penalty.  The penalty is lobo-upbo for boxed columns, the lower
+   bound or minus the upper bound for one-sided columns, plus the scaled
+   cost, so that large bound spans and low costs rank first.  A column enters
+   in the uncovered row of its largest entry if that entry dominates the
+   column, or if the column is small in all rows already covered.  Every
+   pivot row is therefore new, and the basis stays triangular. */
+{
+  MATrec  *mat = lp->matA;
+  int     i, ii, j, k, n, rx, nrows = lp->rows, ncols = lp->columns,
+          uncovered = 0, nentered[3] = {0, 0, 0},
+          *order = NULL, *colclass = NULL, *rcount = NULL;
+  NZINDEX ix, ie;
+  REAL    hold, alpha, gamma, lobo, upbo, cmax = 0,
+          *score = NULL, *vpivot = NULL;
+  MYBOOL  ok, accept;
+
+  report(lp, NORMAL, "crash_basis: 'Bixby' basis crashing selected\n");
+
+  ok = allocINT(lp, &order, ncols + 1, FALSE) &&
+       allocINT(lp, &colclass, ncols + 1, FALSE) &&
+       allocINT(lp, &rcount, nrows + 1, FALSE) &&
+       allocREAL(lp, &score, ncols + 1, FALSE) &&
+       allocREAL(lp, &vpivot, nrows + 1, FALSE);
+  if(!ok)
+    goto Finish;
+
+  /* Only the equality rows whose slack is basic in its own position are
+     uncovered; all other rows are covered by their slack */
+  for(i = 1; i <= nrows; i++) {
+    if(is_fixedvar(lp, i) && (lp->var_basic[i] == i)) {
+      rcount[i] = 0;
+      vpivot[i] = lp->infinite;
+      uncovered++;
+    }
+    else {
+      rcount[i] = 1;
+      vpivot[i] = 1;
+    }
+  }
+  if(uncovered == 0) {
+    report(lp, NORMAL, "crash_basis: No equality rows available for the Bixby basis\n");
+    goto Finish;
+  }
+
+  /* Classify the candidate columns and compute their penalties */
+  for(j = 1; j <= ncols; j++)
+    SETMAX(cmax, fabs(lp->orig_obj[j]));
+  if(cmax == 0)
+    cmax = 1;
+  n = 0;
+  for(j = 1; j <= ncols; j++) {
+    if((mat_collength(mat, j) == 0) || lp->is_basic[nrows + j] || is_fixedvar(lp, nrows + j))
+      continue;
+    lobo = get_lowbo(lp, j);
+    upbo = get_upbo(lp, j);
+    if(my_infinite(lp, lobo) && my_infinite(lp, upbo)) {
+      colclass[j] = 0;
+      hold = 0;
+    }
+    else if(my_infinite(lp, upbo)) {
+      colclass[j] = 1;
+      hold = lobo;
+    }
+    else if(my_infinite(lp, lobo)) {
+      colclass[j] = 1;
+      hold = -upbo;
+    }
+    else {
+      colclass[j] = 2;
+      hold = lobo - upbo;
+    }
+    n++;
+    order[n] = j;
+    score[n] = hold + lp->orig_obj[j] / cmax;
+  }
+  if(n > 1)
+    qsortex(score+1, n, 0, sizeof(*score), FALSE, compareREAL, order+1, sizeof(*order));
+
+  /* Make one pass over the sorted columns for each preference class */
+  for(k = 0; (k <= 2) && (uncovered > 0); k++) {
+    for(ii = 1; (ii <= n) && (uncovered > 0); ii++) {
+      j = order[ii];
+      if(colclass[j] != k)
+        continue;
+
+      /* Find the column maximum and the largest entry in an uncovered row */
+      ie = mat->col_end[j];
+      gamma = 0;
+      alpha = 0;
+      rx = 0;
+      for(ix = mat->col_end[j-1]; ix < ie; ix++) {
+        hold = fabs(COL_MAT_VALUE(ix));
+        SETMAX(gamma, hold);
+        if((rcount[COL_MAT_ROWNR(ix)] == 0) && (hold > alpha)) {
+          alpha = hold;
+          rx = COL_MAT_ROWNR(ix);
+        }
+      }
+      if(rx == 0)
+        continue;
+
+      /* Accept a dominant pivot, or a column that is small in the covered rows */
+      accept = (MYBOOL) (alpha >= CRASH_BIXBYPIVOT*gamma);
+      for(ix = mat->col_end[j-1]; !accept && (ix < ie); ix++) {
+        if((rcount[COL_MAT_ROWNR(ix)] > 0) &&
+           (fabs(COL_MAT_VALUE(ix)) > CRASH_BIXBYSMALL*gamma*vpivot[COL_MAT_ROWNR(ix)]))
+          break;
+      }
+      if(!accept && (ix < ie))
+        continue;
+
+      /* Enter the column and update the row coverage */
+      vpivot[rx] = alpha / gamma;
+      for(ix = mat->col_end[j-1]; ix < ie; ix++)
+        rcount[COL_MAT_ROWNR(ix)]++;
+      set_basisvar(lp, rx, nrows + j);
+      nentered[k]++;
+      uncovered--;
+    }
+  }
+
+  report(lp, NORMAL, "crash_basis: Bixby basis entered %d free, %d one-sided and %d boxed columns; %d equality rows left\n",
+                     nentered[0], nentered[1], nentered[2], uncovered);
+
+  /* Clean up */
+Finish:
+  FREE(order);
+  FREE(colclass);
+  FREE(rcount);
+  FREE(score);
+  FREE(vpivot);
+
+  return( ok );
+}
+
+STATIC void ltsf_link(int *head, int *next, int *prev, int item, int bucket)
+{
+  prev[item] = 0;
+  next[item] = head[bucket];
+  if(head[bucket] > 0)
+    prev[head[bucket]] = item;
+  head[bucket] = item;
+}
+
+STATIC void ltsf_unlink(int *head, int *next, int *prev, int item, int bucket)
+{
+  if(prev[item] > 0)
+    next[prev[item]] = next[item];
+  else
+    head[bucket] = next[item];
+  if(next[item] > 0)
+    prev[next[item]] = prev[item];
+}
+
+STATIC MYBOOL ltsf_basis(lprec *lp)
+/* Lower triangular sparse-first crash after Maros: the rows are visited by
+   how badly we want their slack out of the basis, i.e. equality rows first,
+   then ranged and finally inequality rows, and within each class by the
+   fewest remaining active entries.  The pivot is taken in the active column
+   of the highest type (boxed, one-sided, free) that passes a relative pivot
+   tolerance, preferring short columns.  All active columns of a pivot row
+   are then retired, so that the entered columns form a lower triangular
+   block that factorizes without fill-in.  Free rows keep their slack. */
+{
+  MATrec  *mat = lp->matA;
+  int     i, j, k, rx, cx, rownr, bucket, minptr, nrows = lp->rows, ncols = lp->columns,
+          maxcount = 0, retired = 0, nentered[3] = {0, 0, 0},
+          *rowclass = NULL, *rowcount = NULL, *next = NULL, *prev = NULL, *head = NULL,
+          *colclass = NULL;
+  NZINDEX ix, ii, ie, je;
+  REAL    hold, best = 0, *colmax = NULL;
+  MYBOOL  ok;
+
+  report(lp, NORMAL, "crash_basis: 'LTSF' basis crashing selected\n");
+
+  ok = allocINT(lp, &rowclass, nrows + 1, FALSE) &&
+       allocINT(lp, &rowcount, nrows + 1, TRUE) &&
+       allocINT(lp, &next, nrows + 1, FALSE) &&
+       allocINT(lp, &prev, nrows + 1, FALSE) &&
+       allocINT(lp, &colclass, ncols + 1, FALSE) &&
+       allocREAL(lp, &colmax, ncols + 1, TRUE);
+  if(!ok)
+    goto Finish;
+
+  /* Classify the columns; fixed and basic columns are never active */
+  for(j = 1; j <= ncols; j++) {
+    if(lp->is_basic[nrows + j] || is_fixedvar(lp, nrows + j))
+      colclass[j] = -1;
+    else if(my_infinite(lp, get_lowbo(lp, j)) && my_infinite(lp, get_upbo(lp, j)))
+      colclass[j] = 3;
+    else if(my_infinite(lp, get_lowbo(lp, j)) || my_infinite(lp, get_upbo(lp, j)))
+      colclass[j] = 2;
+    else
+      colclass[j] = 1;
+    ie = mat->col_end[j];
+    for(ix = mat->col_end[j-1]; ix < ie; ix++)
+      SETMAX(colmax[j], fabs(COL_MAT_VALUE(ix)));
+    if(colmax[j] == 0)
+      colclass[j] = -1;
+  }
+
+  /* Classify the rows and count their active entries */
+  for(i = 1; i <= nrows; i++) {
+    if(lp->var_basic[i] != i)
+      rowclass[i] = -1;
+    else if(is_fixedvar(lp, i))
+      rowclass[i] = 0;
+    else if(!my_infinite(lp, lp->orig_upbo[i]))
+      rowclass[i] = 1;
+    else if(!my_infinite(lp, get_rh_upper(lp, i)) || !my_infinite(lp, get_rh_lower(lp, i)))
+      rowclass[i] = 2;
+    else
+      rowclass[i] = -1;
+    if(rowclass[i] < 0)
+      continue;
+    ie = mat->row_end[i];
+    for(ii = mat->row_end[i-1]; ii < ie; ii++)
+      if(colclass[ROW_MAT_COLNR(ii)] > 0)
+        rowcount[i]++;
+    SETMAX(maxcount, rowcount[i]);
+  }
+
+  /* Set up the count buckets of each row class */
+  ok = allocINT(lp, &head, 3*(maxcount + 1), TRUE);
+  if(!ok)
+    goto Finish;
+  for(i = 1; i <= nrows; i++)
+    if((rowclass[i] >= 0) && (rowcount[i] > 0))
+      ltsf_link(head, next, prev, i, rowclass[i]*(maxcount + 1) + rowcount[i]);
+
+  /* Process the rows in order of class and increasing active count */
+  for(k = 0; k <= 2; k++) {
+    minptr = 1;
+    while(minptr <= maxcount) {
+      bucket = k*(maxcount + 1) + minptr;
+      rx = head[bucket];
+      if(rx == 0) {
+        minptr++;
+        continue;
+      }
+      ltsf_unlink(head, next, prev, rx, bucket);
+      rowcount[rx] = 0;
+
+      /* Find the best acceptable pivot column in the row */
+      cx = 0;
+      ie = mat->row_end[rx];
+      for(ii = mat->row_end[rx-1]; ii < ie; ii++) {
+        j = ROW_MAT_COLNR(ii);
+        if(colclass[j] <= k)
+          continue;
+        hold = fabs(ROW_MAT_VALUE(ii)) / colmax[j];
+        if(hold < CRASH_LTSFPIVOT)
+          continue;
+        if((cx == 0) || (colclass[j] > colclass[cx]) ||
+           ((colclass[j] == colclass[cx]) &&
+            ((mat_collength(mat, j) < mat_collength(mat, cx)) ||
+             ((mat_collength(mat, j) == mat_collength(mat, cx)) && (hold > best))))) {
+          cx = j;
+          best = hold;
+        }
+      }
+      if(cx == 0)
+        continue;
+      set_basisvar(lp, rx, nrows + cx);
+      nentered[k]++;
+
+      /* Retire all active columns of the pivot row and update the row counts */
+      for(ii = mat->row_end[rx-1]; ii < ie; ii++) {
+        j = ROW_MAT_COLNR(ii);
+        if(colclass[j] <= 0)
+          continue;
+        colclass[j] = -1;
+        retired++;
+        je = mat->col_end[j];
+        for(ix = mat->col_end[j-1]; ix < je; ix++) {
+          rownr = COL_MAT_ROWNR(ix);
+          if(rowcount[rownr] <= 0)
+            continue;
+          bucket = rowclass[rownr]*(maxcount + 1) + rowcount[rownr];
+          ltsf_unlink(head, next, prev, rownr, bucket);
+          rowcount[rownr]--;
+          if(rowcount[rownr] > 0) {
+            ltsf_link(head, next, prev, rownr, bucket - 1);
+            if(rowclass[rownr] == k)
+              SETMIN(minptr, rowcount[rownr]);
+          }
+        }
+      }
+    }
+  }
+
+  report(lp, NORMAL, "crash_basis: LTSF basis entered %d columns in equality, %d in ranged and %d in inequality rows; %d columns retired\n",
+                     nentered[0], nentered[1], nentered[2], retired);
+
+  /* Clean up */
+Finish:
+  FREE(rowclass);
+  FREE(rowcount);
+  FREE(next);
+  FREE(prev);
+  FREE(head);
+  FREE(colclass);
+  FREE(colmax);
+
+  return( ok );
+}
@@ -11,6 +11,38 @@
 #define CRASH_SPACER        10
 #define CRASH_WEIGHT     0.500
 
+#define CRASH_SIFTRATIO     10    /* Minimum column/row ratio for sifting */
+#define CRASH_SIFTSIZE       3    /* Initial working set size as a multiple of the row count */
+#define CRASH_SIFTMAXLOOP   50    /* Maximum number of sifting passes */
+#define CRASH_SIFTPENALTY  1.0e+4 /* Relative cost of the artificial sifting columns */
+
+#define CRASH_DECOMPMAXBLOCKS  64 /* Maximum number of decomposition blocks */
+#define CRASH_DECOMPMAXLOOP   100 /* Maximum number of column generation passes */
+#define CRASH_DECOMPMAXLINK  0.10 /* Maximum fraction of linking rows */
+#define CRASH_DECOMPMINJUMP     2 /* Minimum relative row span increase at the linking rows */
+
+#define CRASH_NETBLOCKSIZE   1.0  /* Pricing block size as a multiple of the square root of the arc count */
+#define CRASH_NETMINBLOCK     10  /* Minimum pricing block size */
+#define CRASH_NETMAXPIVOTS    50  /* Maximum number of pivots as a multiple of the arc count */
+
+#define CRASH_BIXBYPIVOT    0.99  /* Relative size of a dominant Bixby pivot */
+#define CRASH_BIXBYSMALL    0.01  /* Relative size limit of entries in covered rows */
+#define CRASH_LTSFPIVOT     0.10  /* Relative pivot tolerance of the LTSF crash */
+
+/* Spanning tree state of the network simplex; nodes 0..rows are the model
+   rows with node 0 taking the role of the ground node of the slacks, while
+   node rows+1 is the root of the artificial arcs */
+typedef struct _netrec
+{
+  int    nodes, arcs, root;
+  int    *source, *target, *varnr, *state;
+  REAL   *cost, *cap, *flow;
+  int    *parent, *pred, *preddir, *thread, *revthread, *succnum, *lastsucc, *dirty;
+  REAL   *supply, *pi;
+  int    inarc, joinnode, uin, vin, uout, nextarc, blocksize;
+  REAL   delta, infinity, epsvalue;
+} netrec;
+
 
 
 #ifdef __cplusplus
@@ -18,6 +50,12 @@ __EXTERN_C {
 #endif
 
 STATIC MYBOOL crash_basis(lprec *lp);
+STATIC MYBOOL sift_basis(lprec *lp);
+STATIC int crash_findBlocks(lprec *lp, int *rowblock, int *colblock);
+STATIC MYBOOL decompose_basis(lprec *lp);
+STATIC MYBOOL network_basis(lprec *lp);
+STATIC MYBOOL bixby_basis(lprec *lp);
+STATIC MYBOOL ltsf_basis(lprec *lp);
 
 #ifdef __cplusplus
 }
@@ -453,6 +453,8 @@ int __WINAPI solve(lprec *lp)
 
   if(has_BFP(lp)) {
     lp->solvecount++;
+    if(lp->update_count > 0)
+      flush_update(lp);
     if(is_add_rowmode(lp))
       set_add_rowmode(lp, FALSE);
     return(lin_solve(lp));
@@ -605,6 +607,25 @@ int __WINAPI get_maxpivot(lprec *lp)
   return( lp->bfp_pivotmax(lp) );
 }
 
+void __WINAPI set_memory_policy(lprec *lp, int policy)
+{
+  MATrec *mat = lp->matA;
+
+  lp->memory_policy = policy;
+
+  /* Move the existing constraint matrix storage over to the new policy */
+  if((policy & MEMORY_ALLOCMASK) && (mat != NULL))
+    mat_memopt(mat, mat->rows_alloc - mat->rows, mat->columns_alloc - mat->columns,
+                    mat->mat_alloc - mat_nonzeros(mat));
+  if(!(policy & MEMORY_HASHINDEX) && (mat != NULL))
+    mat_hashfree(mat);
+}
+
+int __WINAPI get_memory_policy(lprec *lp)
+{
+  return( lp->memory_policy );
+}
+
 void __WINAPI set_bb_rule(lprec *lp, int bb_rule)
 {
   lp->bb_rule = bb_rule;
@@ -1011,7 +1032,7 @@ REAL __WINAPI get_objective(lprec *lp)
 
 int __WINAPI get_nonzeros(lprec *lp)
 {
-  return( mat_nonzeros(lp->matA) );
+  return( (int) mat_nonzeros(lp->matA) );
 }
 
 MYBOOL __WINAPI set_mat(lprec *lp, int rownr, int colnr, REAL value)
@@ -1025,6 +1046,22 @@ MYBOOL __WINAPI set_mat(lprec *lp, int rownr, int colnr, REAL value)
     return( FALSE );
   }
 
+  /* Queue constraint matrix changes while an update is open */
+  if(lp->update_active && (rownr > 0)) {
+    if(lp->update_count == lp->update_alloc) {
+      lp->update_alloc += MAX(lp->update_alloc / RESIZEFACTOR, DELTACOLALLOC);
+      if(!allocINT(lp, &lp->update_rownr, lp->update_alloc, AUTOMATIC) ||
+         !allocINT(lp, &lp->update_colnr, lp->update_alloc, AUTOMATIC) ||
+         !allocREAL(lp, &lp->update_value, lp->update_alloc, AUTOMATIC))
+        return( FALSE );
+    }
+    lp->update_rownr[lp->update_count] = rownr;
+    lp->update_colnr[lp->update_count] = colnr;
+    lp->update_value[lp->update_count] = value;
+    lp->update_count++;
+    return( TRUE );
+  }
+
 #ifdef DoMatrixRounding
   if(rownr == 0)
     value = roundToPrecision(value, lp->matA->epsvalue);
@@ -1038,6 +1075,129 @@ MYBOOL __WINAPI set_mat(lprec *lp, int rownr, int colnr, REAL value)
     return( mat_setvalue(lp->matA, rownr, colnr, value, FALSE) );
 }
 
+MYBOOL __WINAPI set_mat_batch(lprec *lp, int count, int *rownr, int *colnr, REAL *values)
+/* Set count elements as if by successive set_mat calls, but merge them with the
+   constraint matrix in a single pass instead of shifting the matrix tail for every
+   new element; objective entries (row 0) are set directly */
+{
+  int    i, n, *rowno = NULL, *colno = NULL;
+  REAL   value, *matvalue = NULL;
+  MYBOOL status;
+
+  if(count <= 0)
+    return( TRUE );
+  if((rownr == NULL) || (colnr == NULL) || (values == NULL)) {
+    report(lp, IMPORTANT, "set_mat_batch: Invalid data arrays\n");
+    return( FALSE );
+  }
+  for(i = 0; i < count; i++) {
+    if((rownr[i] < 0) || (rownr[i] > lp->rows)) {
+      report(lp, IMPORTANT, "set_mat_batch: Row %d out of range\n", rownr[i]);
+      return( FALSE );
+    }
+    if((colnr[i] < 1) || (colnr[i] > lp->columns)) {
+      report(lp, IMPORTANT, "set_mat_batch: Column %d out of range\n", colnr[i]);
+      return( FALSE );
+    }
+  }
+
+  /* Apply queued set_mat changes first, so that the calls take effect in order */
+  if(lp->update_count > 0)
+    flush_update(lp);
+
+  /* Split free variables are mirrored element by element in mat_setvalue */
+  if(lp->var_is_free != NULL) {
+    status = TRUE;
+    for(i = 0; (i < count) && status; i++)
+      status = set_mat(lp, rownr[i], colnr[i], values[i]);
+    return( status );
+  }
+
+  /* Set the objective entries, and collect the rest in storage coordinates */
+  if(!allocINT(lp, &rowno, count, FALSE) ||
+     !allocINT(lp, &colno, count, FALSE) ||
+     !allocREAL(lp, &matvalue, count, FALSE)) {
+    FREE(rowno);
+    FREE(colno);
+    return( FALSE );
+  }
+  n = 0;
+  for(i = 0; i < count; i++) {
+    value = values[i];
+    if(rownr[i] == 0) {
+#ifdef DoMatrixRounding
+      value = roundToPrecision(value, lp->matA->epsvalue);
+#endif
+      lp->orig_obj[colnr[i]] = my_chsign(is_chsign(lp, 0), scaled_mat(lp, value, 0, colnr[i]));
+      continue;
+    }
+    value = scaled_mat(lp, value, rownr[i], colnr[i]);
+    matvalue[n] = my_chsign(is_chsign(lp, rownr[i]), value);
+    if(lp->matA->is_roworder) {
+      rowno[n] = colnr[i];
+      colno[n] = rownr[i];
+    }
+    else {
+      rowno[n] = rownr[i];
+      colno[n] = colnr[i];
+    }
+    n++;
+  }
+  status = mat_setbatch(lp->matA, n, rowno, colno, matvalue);
+
+  FREE(rowno);
+  FREE(colno);
+  FREE(matvalue);
+  return( status );
+}
+
+MYBOOL __WINAPI begin_update(lprec *lp)
+/* Open an update of the model; set_mat queues its constraint matrix changes until
+   commit_update, so that thousands of scattered coefficient changes cost one merge
+   and one row index rebuild instead of a matrix tail shift each.  Objective, right
+   hand side and bound changes are plain vector writes and still apply directly */
+{
+  if(lp->update_active) {
+    report(lp, IMPORTANT, "begin_update: An update is already open\n");
+    return( FALSE );
+  }
+  lp->update_active = TRUE;
+  lp->update_count = 0;
+  return( TRUE );
+}
+
+MYBOOL __WINAPI commit_update(lprec *lp)
+{
+  MYBOOL status;
+
+  if(!lp->update_active) {
+    report(lp, IMPORTANT, "commit_update: No update is open\n");
+    return( FALSE );
+  }
+  status = flush_update(lp);
+  lp->update_active = FALSE;
+  FREE(lp->update_rownr);
+  FREE(lp->update_colnr);
+  FREE(lp->update_value);
+  lp->update_alloc = 0;
+  return( status );
+}
+
+STATIC MYBOOL flush_update(lprec *lp)
+/* Apply the queued matrix changes of an open update, which stays open */
+{
+  MYBOOL status = TRUE;
+  int    count = lp->update_count;
+
+  if(count > 0) {
+    lp->update_count = 0;
+    lp->update_active = FALSE;
+    status = set_mat_batch(lp, count, lp->update_rownr, lp->update_colnr, lp->update_value);
+    lp->update_active = TRUE;
+  }
+  return( status );
+}
+
 REAL __WINAPI get_working_objective(lprec *lp)
 {
   REAL value = 0.0;
@@ -1556,6 +1716,9 @@ void __WINAPI delete_lp(lprec *lp)
     free_hash_table(lp->colname_hashtab);
   }
 
+  FREE(lp->update_rownr);
+  FREE(lp->update_colnr);
+  FREE(lp->update_value);
   mat_free(&lp->matA);
   lp->bfp_free(lp);
 #if LoadInverseLib == TRUE
@@ -1569,6 +1732,7 @@ void __WINAPI delete_lp(lprec *lp)
 
   unset_OF_p1extra(lp);
   FREE(lp->orig_obj);
+  FREE(lp->obj_perturb);
   FREE(lp->orig_rhs);
   FREE(lp->rhs);
   FREE(lp->var_type);
@@ -1734,6 +1898,7 @@ lprec* __WINAPI copy_lp(lprec *lp)
   set_improve(newlp, get_improve(lp));
   set_basiscrash(newlp, get_basiscrash(lp));
   set_maxpivot(newlp, get_maxpivot(lp));
+  set_memory_policy(newlp, get_memory_policy(lp));
   set_timeout(newlp, get_timeout(lp));
 
   /* Transfer MILP parameters */
@@ -1836,7 +2001,7 @@ Finish:
 }
 MYBOOL __WINAPI dualize_lp(lprec *lp)
 {
-  int     i, n;
+  NZINDEX i, n;
   MATrec  *mat = lp->matA;
   REAL    *item;
 
@@ -1974,8 +2139,10 @@ STATIC void varmap_delete(lprec *lp, int base, int delta, LLrec *varmap)
   MYBOOL          preparecompact = (MYBOOL) (varmap != NULL);
   presolveundorec *psundo = lp->presolve_undo;
 
-  /* Set the model "dirty" if we are deleting row of constraint */
-  lp->model_is_pure &= (MYBOOL) ((lp->solutioncount == 0) && !preparecompact);
+  /* Set the model "dirty" if we are deleting row of constraint; a mass deletion
+     from an unlocked model is treated like a sequence of single deletions */
+  lp->model_is_pure &= (MYBOOL) ((lp->solutioncount == 0) &&
+                                 !(preparecompact && lp->varmap_locked));
 
   /* Don't do anything if
      1) variables aren't locked yet, or
@@ -2316,7 +2483,20 @@ STATIC MYBOOL shift_basis(lprec *lp, int base, int delta, LLrec *usedmap, MYBOOL
   }
   /* Basis adjustments due to deletions (after actual row/column deletions) */
   else {
-    int j,k;
+    int j,k, *newidx = NULL;
+
+    /* Map old to new variable indexes for mass deletion via a linked list;
+       the map covers the rows when isrow, otherwise the columns */
+    if(usedmap != NULL) {
+      k = (isrow ? lp->rows : lp->columns);
+      allocINT(lp, &newidx, lp->sum+1, FALSE);
+      for(i = 1, j = 0; i <= lp->sum; i++) {
+        if((i < base) || (i >= base+k) || isActiveLink(usedmap, i-base+1))
+          newidx[i] = ++j;
+        else
+          newidx[i] = -1;
+      }
+    }
 
     /* Fix invalid basis references (decrement high basic slack variable indexes),
        but reset the entire basis if a deleted variable is found in the basis */
@@ -2324,7 +2504,14 @@ STATIC MYBOOL shift_basis(lprec *lp, int base, int delta, LLrec *usedmap, MYBOOL
     for(i = 1; i <= lp->rows; i++) {
       ii = lp->var_basic[i];
       lp->is_basic[ii] = FALSE;
-      if(ii >= base) {
+      if(newidx != NULL) {
+        if(newidx[ii] < 0) {
+          set_action(&lp->spx_action, ACTION_REBASE);
+          continue;
+        }
+        ii = newidx[ii];
+      }
+      else if(ii >= base) {
        /* Skip to next basis variable if this one is to be deleted */
         if(ii < base-delta) {
           set_action(&lp->spx_action, ACTION_REBASE);
@@ -2369,6 +2556,7 @@ STATIC MYBOOL shift_basis(lprec *lp, int base, int delta, LLrec *usedmap, MYBOOL
       Ok = FALSE;
     if(isrow || (k != lp->rows))
       set_action(&lp->spx_action, ACTION_REINVERT);
+    FREE(newidx);
 
   }
   return(Ok);
@@ -2380,6 +2568,10 @@ STATIC MYBOOL shift_rowdata(lprec *lp, int base, int delta, LLrec *usedmap)
 {
   int i, ii;
 
+  /* Apply queued matrix changes while their row indexes are still valid */
+  if(lp->update_count > 0)
+    flush_update(lp);
+
   /* Shift sparse matrix row data */
   if(lp->matA->is_roworder)
     mat_shiftcols(lp->matA, &base, delta, usedmap);
@@ -2445,6 +2637,10 @@ STATIC MYBOOL shift_coldata(lprec *lp, int base, int delta, LLrec *usedmap)
 {
   int i, ii;
 
+  /* Apply queued matrix changes while their column indexes are still valid */
+  if(lp->update_count > 0)
+    flush_update(lp);
+
   if(lp->bb_totalnodes == 0)
     free_duals(lp);
 
@@ -2570,6 +2766,8 @@ STATIC MYBOOL shift_coldata(lprec *lp, int base, int delta, LLrec *usedmap)
       if(lp->best_solution != NULL)
         lp->best_solution[lp->rows + i] = lp->best_solution[lp->rows + ii];
     }
+    delta = i - lp->columns - 1;
+
     /* Shift variable priority data */
     if((lp->var_priority != NULL) || (lp->sos_priority != NULL)) {
       int *colmap = NULL, k;
@@ -2601,8 +2799,6 @@ STATIC MYBOOL shift_coldata(lprec *lp, int base, int delta, LLrec *usedmap)
       }
       FREE(colmap);
     }
-
-    delta = i - lp->columns - 1;
   }
   else if(delta < 0) {
 
@@ -2638,8 +2834,6 @@ STATIC MYBOOL shift_coldata(lprec *lp, int base, int delta, LLrec *usedmap)
       if(lp->objtill != NULL)
         lp->objtill[i] = lp->objtill[ii];
 */
-      if(lp->var_priority != NULL)
-        lp->var_priority[i-1] = lp->var_priority[ii-1];
       if(lp->bb_varbranch != NULL)
         lp->bb_varbranch[i-1] = lp->bb_varbranch[ii-1];
       if(lp->var_is_free != NULL)
@@ -2648,17 +2842,18 @@ STATIC MYBOOL shift_coldata(lprec *lp, int base, int delta, LLrec *usedmap)
         lp->best_solution[lp->rows + i] = lp->best_solution[lp->rows + ii];
     }
 
-    /* Fix invalid variable priority data */
+    /* Fix invalid variable priority data (an ordered list of columns, so it is
+       filtered by value below rather than shifted by position) */
     if(lp->var_priority != NULL) {
       for(i = 0, ii = 0; i < lp->columns; i++)
-        if(lp->var_priority[i] > base - delta)
+        if(lp->var_priority[i] >= base - delta)
           lp->var_priority[ii++] = lp->var_priority[i] + delta;
         else if(lp->var_priority[i] < base)
           lp->var_priority[ii++] = lp->var_priority[i];
     }
     if(lp->sos_priority != NULL) {
       for(i = 0, ii = 0; i < lp->sos_vars; i++) {
-        if(lp->sos_priority[i] > base - delta)
+        if(lp->sos_priority[i] >= base - delta)
           lp->sos_priority[ii++] = lp->sos_priority[i] + delta;
         else if(lp->sos_priority[i] < base)
           lp->sos_priority[ii++] = lp->sos_priority[i];
@@ -3077,6 +3272,8 @@ MYBOOL __WINAPI set_row(lprec *lp, int rownr, REAL *row)
     report(lp, IMPORTANT, "set_row: Row %d out of range\n", rownr);
     return( FALSE );
   }
+  if(lp->update_count > 0)
+    flush_update(lp);
   if(rownr == 0)
     return( set_obj_fn(lp, row) );
   else
@@ -3089,6 +3286,8 @@ MYBOOL __WINAPI set_rowex(lprec *lp, int rownr, int count, REAL *row, int *colno
     report(lp, IMPORTANT, "set_rowex: Row %d out of range\n", rownr);
     return( FALSE );
   }
+  if(lp->update_count > 0)
+    flush_update(lp);
   if(rownr == 0)
     return( set_obj_fnex(lp, count, row, colno) );
   else
@@ -3271,6 +3470,47 @@ MYBOOL __WINAPI del_constraint(lprec *lp, int rownr)
   return(TRUE);
 }
 
+/* Delete an arbitrary set of constraints with a single pass over the matrix
+   and the row data; duplicate indexes in the list are ignored */
+MYBOOL __WINAPI del_constraints_batch(lprec *lp, int count, int *rownr)
+{
+  int    i, prev_rows, prev_cols;
+  LLrec  *rowmap = NULL;
+  MYBOOL status;
+
+  if((count < 0) || ((count > 0) && (rownr == NULL))) {
+    report(lp, IMPORTANT, "del_constraints_batch: Invalid constraint list of length %d\n", count);
+    return(FALSE);
+  }
+  for(i = 0; i < count; i++)
+    if((rownr[i] < 1) || (rownr[i] > lp->rows)) {
+      report(lp, IMPORTANT, "del_constraints_batch: Attempt to delete non-existing constraint %d\n", rownr[i]);
+      return(FALSE);
+    }
+  if(count == 0)
+    return(TRUE);
+
+  /* Create the map of constraints to keep */
+  createLink(lp->rows, &rowmap, NULL);
+  fillLink(rowmap);
+  for(i = 0; i < count; i++)
+    if(isActiveLink(rowmap, rownr[i]))
+      removeLink(rowmap, rownr[i]);
+
+  /* Shift the row data, then remove the marked elements and compact the variable map */
+  prev_rows = lp->rows;
+  prev_cols = lp->columns;
+  status = del_constraintex(lp, rowmap);
+  if(lp->matA->is_roworder)
+    mat_colcompact(lp->matA, prev_cols, prev_rows, rowmap);
+  else
+    mat_rowcompact(lp->matA, FALSE);
+  varmap_compact(lp, prev_rows, prev_cols);
+  freeLink(&rowmap);
+
+  return(status);
+}
+
 MYBOOL __WINAPI add_lag_con(lprec *lp, REAL *row, int con_type, REAL rhs)
 {
   int  k;
@@ -3362,11 +3602,16 @@ void del_splitvars(lprec *lp)
 
 MYBOOL __WINAPI set_column(lprec *lp, int colnr, REAL *column)
 {
+  /* Apply queued set_mat changes first, so that the calls take effect in order */
+  if(lp->update_count > 0)
+    flush_update(lp);
   return( mat_setcol(lp->matA, colnr, lp->rows, column, NULL, TRUE, TRUE) );
 }
 
 MYBOOL __WINAPI set_columnex(lprec *lp, int colnr, int count, REAL *column, int *rowno)
 {
+  if(lp->update_count > 0)
+    flush_update(lp);
   return( mat_setcol(lp->matA, colnr, count, column, rowno, TRUE, TRUE) );
 }
 
@@ -3442,6 +3687,136 @@ MYBOOL __WINAPI str_add_column(lprec *lp, char *col_string)
   return( ret );
 }
 
+MYBOOL __WINAPI load_model_csc(lprec *lp, int rows, int columns,
+                               NZINDEX *col_start, int *row_idx, REAL *values,
+                               REAL *lower, REAL *upper, REAL *obj, REAL *rhs,
+                               int *con_type, MYBOOL *is_int)
+/* This function loads a complete model into an empty lp in one operation, taking
+   the constraint matrix in compressed sparse column form:
+
+    1: Column j has its non-zeros at positions col_start[j-1]..col_start[j]-1
+       of row_idx/values, with row indexes in ascending order (0 = objective)
+    2: obj, lower, upper and is_int are indexed 1..columns, and rhs and con_type
+       1..rows, like set_obj_fn and set_rh_vec; each may be NULL for defaults
+    3: The default is a continuous [0, infinity] column and a LE row.
+
+   The matrix storage is sized once and the row index is built in a single pass,
+   avoiding the incremental growth of add_columnex and the transpose of row mode */
+{
+  int     i, j;
+  NZINDEX n;
+  REAL    value, lobo, upbo;
+  MYBOOL  chsgn;
+
+  if((lp->rows > 0) || (lp->columns > 0) || lp->matA->is_roworder || lp->scaling_used) {
+    report(lp, IMPORTANT, "load_model_csc: Can only load into an empty and unscaled model\n");
+    return( FALSE );
+  }
+  if((rows < 0) || (columns < 0) || ((columns > 0) && (col_start == NULL)) ||
+     ((columns > 0) && (col_start[columns] > col_start[0]) &&
+      ((row_idx == NULL) || (values == NULL)))) {
+    report(lp, IMPORTANT, "load_model_csc: Invalid model dimensions or data arrays\n");
+    return( FALSE );
+  }
+
+ /* Check all the data before the model is changed, so that a rejected load leaves
+    the lp empty */
+  for(j = 1; j <= columns; j++) {
+    if(col_start[j] < col_start[j-1]) {
+      report(lp, IMPORTANT, "load_model_csc: Column %d has a negative length\n", j);
+      return( FALSE );
+    }
+    i = -1;
+    for(n = col_start[j-1]; n < col_start[j]; n++) {
+      if((row_idx[n] <= i) || (row_idx[n] > rows)) {
+        report(lp, IMPORTANT, "load_model_csc: Invalid or non-ascending row index %d in column %d\n",
+                              row_idx[n], j);
+        return( FALSE );
+      }
+      i = row_idx[n];
+    }
+  }
+  if(con_type != NULL)
+  for(i = 1; i <= rows; i++) {
+    j = con_type[i];
+    if(((j & ROWTYPE_CONSTRAINT) != EQ) && ((j & LE) == 0) && ((j & GE) == 0) && (j != FR)) {
+      report(lp, IMPORTANT, "load_model_csc: Constraint type %d not implemented (row %d)\n",
+                            j, i);
+      return( FALSE );
+    }
+  }
+  if((lower != NULL) || (upper != NULL))
+  for(j = 1; j <= columns; j++) {
+    lobo = (lower == NULL ? 0 : lower[j]);
+    upbo = (upper == NULL ? lp->infinite : upper[j]);
+    if((upbo <= -lp->infinite) || (lobo >= lp->infinite) ||
+       ((lobo > upbo) && (fabs(upbo - lobo) >= lp->epsvalue))) {
+      report(lp, IMPORTANT, "load_model_csc: Invalid bounds [%g, %g] for column %d\n",
+                            lobo, upbo, j);
+      return( FALSE );
+    }
+  }
+
+ /* Prepare the row and column vectors */
+  if(((rows > 0) && !append_rows(lp, rows)) ||
+     ((columns > 0) && !append_columns(lp, columns)))
+    return( FALSE );
+
+ /* Set the constraint types and right hand sides while the matrix is still empty,
+    so that no row sign changes are needed afterwards */
+  for(i = 1; i <= rows; i++) {
+    j = (con_type == NULL ? LE : con_type[i]);
+    if((j & ROWTYPE_CONSTRAINT) == EQ) {
+      lp->equalities++;
+      lp->orig_upbo[i] = 0;
+      lp->upbo[i] = 0;
+    }
+    else
+      lp->orig_upbo[i] = lp->infinite;
+    lp->row_type[i] = (j == FR ? LE : j);
+    if(j == FR)
+      lp->orig_rhs[i] = lp->infinite;
+    else if(rhs != NULL)
+      lp->orig_rhs[i] = my_chsign(is_chsign(lp, i), rhs[i]);
+  }
+
+ /* Copy the constraint matrix */
+  n = mat_appendcsc(lp->matA, columns, col_start, row_idx, values);
+  if(n < 0) {
+    report(lp, SEVERE, "load_model_csc: Could not store the constraint matrix\n");
+    return( FALSE );
+  }
+
+ /* Set the column data */
+  if(obj != NULL) {
+    chsgn = is_maxim(lp);
+    for(j = 1; j <= columns; j++) {
+      value = obj[j];
+#ifdef DoMatrixRounding
+      value = roundToPrecision(value, lp->matA->epsvalue);
+#endif
+      lp->orig_obj[j] = my_chsign(chsgn, value);
+    }
+  }
+  if((lower != NULL) || (upper != NULL)) {
+    for(j = 1; j <= columns; j++)
+      set_bounds(lp, j, (lower == NULL ? 0 : lower[j]),
+                        (upper == NULL ? lp->infinite : upper[j]));
+  }
+  if(is_int != NULL) {
+    for(j = 1; j <= columns; j++)
+      if(is_int[j])
+        set_int(lp, j, TRUE);
+  }
+
+  set_action(&lp->spx_action, ACTION_REINVERT);
+  lp->basis_valid = FALSE;
+  if(!lp->varmap_locked)
+    presolve_setOrig(lp, lp->rows, lp->columns);
+
+  return( TRUE );
+}
+
 STATIC MYBOOL del_varnameex(lprec *lp, hashelem **namelist, int items, hashtable *ht, int varnr, LLrec *varmap)
 {
   int i, n;
@@ -3465,7 +3840,9 @@ STATIC MYBOOL del_varnameex(lprec *lp, hashelem **namelist, int items, hashtable
   /* Then compress the name list */
   if(varmap != NULL) {
     i = firstInactiveLink(varmap);
-    n = nextActiveLink(varmap, i);
+    n = firstActiveLink(varmap);
+    if(n < i)
+      n = nextActiveLink(varmap, i);
     varnr = i;
   }
   else {
@@ -3478,7 +3855,7 @@ STATIC MYBOOL del_varnameex(lprec *lp, hashelem **namelist, int items, hashtable
       namelist[i]->index -= n - i;
     i++;
     if(varmap != NULL)
-      n = nextActiveLink(varmap, i);
+      n = nextActiveLink(varmap, n);
     else if(n <= items) /* items has been updated for the new count */
       n++;
     else
@@ -3538,6 +3915,56 @@ MYBOOL __WINAPI del_column(lprec *lp, int colnr)
   return(TRUE);
 }
 
+/* Delete an arbitrary set of columns with a single pass over the matrix
+   and the column data; duplicate indexes in the list are ignored */
+MYBOOL __WINAPI del_columns_batch(lprec *lp, int count, int *colnr)
+{
+  int    i, prev_rows, prev_cols;
+  LLrec  *colmap = NULL;
+  MYBOOL status = TRUE;
+
+  if((count < 0) || ((count > 0) && (colnr == NULL))) {
+    report(lp, IMPORTANT, "del_columns_batch: Invalid column list of length %d\n", count);
+    return(FALSE);
+  }
+  for(i = 0; i < count; i++)
+    if((colnr[i] < 1) || (colnr[i] > lp->columns)) {
+      report(lp, IMPORTANT, "del_columns_batch: Column %d out of range\n", colnr[i]);
+      return(FALSE);
+    }
+  if(count == 0)
+    return(TRUE);
+
+  /* Create the map of columns to keep */
+  createLink(lp->columns, &colmap, NULL);
+  fillLink(colmap);
+  for(i = 0; i < count; i++)
+    if(isActiveLink(colmap, colnr[i]))
+      removeLink(colmap, colnr[i]);
+
+  /* Split free variables are renumbered by the single column deletions only;
+     delete from the highest index down so the remaining indexes stay valid */
+  if(lp->var_is_free != NULL) {
+    for(i = lastInactiveLink(colmap); (i != 0) && status; i = prevInactiveLink(colmap, i))
+      status = del_column(lp, i);
+  }
+
+  /* Shift the column data, then remove the marked elements and compact the variable map */
+  else {
+    prev_rows = lp->rows;
+    prev_cols = lp->columns;
+    status = del_columnex(lp, colmap);
+    if(lp->matA->is_roworder)
+      mat_rowcompact(lp->matA, FALSE);
+    else
+      mat_colcompact(lp->matA, prev_rows, prev_cols, colmap);
+    varmap_compact(lp, prev_rows, prev_cols);
+  }
+  freeLink(&colmap);
+
+  return(status);
+}
+
 void __WINAPI set_simplextype(lprec *lp, int simplextype)
 {
   lp->simplex_strategy = simplextype;
@@ -4427,11 +4854,12 @@ REAL __WINAPI get_constr_value(lprec *lp, int rownr, int count, REAL *primsoluti
         value += get_mat(lp, rownr, nzindex[i]) * primsolution[i];
     }
     else {
-      int j;
+      int     j;
+      NZINDEX ix;
 
-      for(i = mat->row_end[rownr-1]; i < mat->row_end[rownr]; i++) {
-        j = ROW_MAT_COLNR(i);
-        value += unscaled_mat(lp, ROW_MAT_VALUE(i), rownr, j) * primsolution[j];
+      for(ix = mat->row_end[rownr-1]; ix < mat->row_end[rownr]; ix++) {
+        j = ROW_MAT_COLNR(ix);
+        value += unscaled_mat(lp, ROW_MAT_VALUE(ix), rownr, j) * primsolution[j];
       }
       value = my_chsign(is_chsign(lp, rownr), value);
     }
@@ -4472,7 +4900,8 @@ STATIC int get_constr_class(lprec *lp, int rownr)
 {
   int    aBIN = 0, aINT = 0, aREAL = 0,
          xBIN = 0, xINT = 0, xREAL = 0;
-  int    j, elmnr, elmend, nelm;
+  int    j, nelm;
+  NZINDEX elmnr, elmend;
   MYBOOL chsign;
   REAL   a;
   MATrec *mat = lp->matA;
@@ -4492,7 +4921,7 @@ STATIC int get_constr_class(lprec *lp, int rownr)
   else {
     elmnr  = mat->row_end[rownr - 1];
     elmend = mat->row_end[rownr];
-    nelm = elmend - elmnr;
+    nelm = (int) (elmend - elmnr);
   }
   chsign = is_chsign(lp, rownr);
   for(; elmnr < elmend; elmnr++) {
@@ -4500,7 +4929,7 @@ STATIC int get_constr_class(lprec *lp, int rownr)
       a = lp->orig_obj[elmnr];
       if(a == 0)
         continue;
-      j = elmnr;
+      j = (int) elmnr;
     }
     else {
       j = ROW_MAT_COLNR(elmnr);
@@ -4555,8 +4984,8 @@ STATIC int get_constr_class(lprec *lp, int rownr)
 
 REAL __WINAPI get_mat(lprec *lp, int rownr, int colnr)
 {
-  REAL value;
-  int  elmnr;
+  REAL    value;
+  NZINDEX elmnr;
   int colnr1 = colnr, rownr1 = rownr;
 
   if((rownr < 0) || (rownr > lp->rows)) {
@@ -4587,7 +5016,7 @@ REAL __WINAPI get_mat(lprec *lp, int rownr, int colnr)
   return(value);
 }
 
-REAL __WINAPI get_mat_byindex(lprec *lp, int matindex, MYBOOL isrow, MYBOOL adjustsign)
+REAL __WINAPI get_mat_byindex(lprec *lp, NZINDEX matindex, MYBOOL isrow, MYBOOL adjustsign)
 /* Note that this function does not adjust for sign-changed GT constraints! */
 {
   int  *rownr, *colnr;
@@ -4625,9 +5054,9 @@ static int mat_getrow(lprec *lp, int rownr, REAL *row, int *colno)
     }
   }
   else {
-    MYBOOL chsign = FALSE;
-    int    ie, i;
-    MATrec *mat = lp->matA;
+    MYBOOL  chsign = FALSE;
+    NZINDEX ie, i;
+    MATrec  *mat = lp->matA;
 
     if(colno == NULL)
       MEMCLEAR(row, lp->columns+1);
@@ -4669,9 +5098,10 @@ static int mat_getrow(lprec *lp, int rownr, REAL *row, int *colno)
 
 static int mat_getcolumn(lprec *lp, int colnr, REAL *column, int *nzrow)
 {
-  int    n = 0, i, ii, ie, *rownr;
-  REAL   hold, *value;
-  MATrec *mat = lp->matA;
+  int     n = 0, ii, *rownr;
+  NZINDEX i, ie;
+  REAL    hold, *value;
+  MATrec  *mat = lp->matA;
 
   if(nzrow == NULL)
     MEMCLEAR(column, lp->rows + 1);
@@ -4693,7 +5123,7 @@ static int mat_getcolumn(lprec *lp, int colnr, REAL *column, int *nzrow)
   i  = lp->matA->col_end[colnr - 1];
   ie = lp->matA->col_end[colnr];
   if(nzrow == NULL)
-    n += ie - i;
+    n += (int) (ie - i);
   rownr = &COL_MAT_ROWNR(i);
   value = &COL_MAT_VALUE(i);
   for(; i < ie;
@@ -4796,6 +5226,10 @@ MYBOOL modifyOF1(lprec *lp, int index, REAL *ofValue, REAL mult)
     }
   }
 
+  /* Add any active anti-degeneracy cost perturbation */
+  if(accept && (lp->obj_perturb != NULL) && (index > lp->rows))
+    (*ofValue) += lp->obj_perturb[index - lp->rows];
+
   /* Do scaling and test for zero */
   if(accept) {
     (*ofValue) *= mult;
@@ -4880,7 +5314,8 @@ STATIC int singleton_column(lprec *lp, int row_nr, REAL *column, int *nzlist, RE
 
 STATIC int expand_column(lprec *lp, int col_nr, REAL *column, int *nzlist, REAL mult, int *maxabs)
 {
-  int     i, ie, j, maxidx, nzcount;
+  int     j, maxidx, nzcount;
+  NZINDEX i, ie;
   REAL    value, maxval;
   MATrec  *mat = lp->matA;
   REAL    *matValue;
@@ -4895,7 +5330,7 @@ STATIC int expand_column(lprec *lp, int col_nr, REAL *column, int *nzlist, REAL
     ie = mat->col_end[col_nr];
     matRownr = &COL_MAT_ROWNR(i);
     matValue = &COL_MAT_VALUE(i);
-    nzcount = i;
+    nzcount = (int) (ie - i);
     for(; i < ie;
         i++, matRownr += matRowColStep, matValue += matValueStep) {
       j = *matRownr;
@@ -4909,7 +5344,6 @@ STATIC int expand_column(lprec *lp, int col_nr, REAL *column, int *nzlist, REAL
       }
       column[j] = value;
     }
-    nzcount = i - nzcount;
 
     /* Get the objective as row 0, optionally adjusting the objective for phase 1 */
     if(lp->obj_in_basis) {
@@ -4983,11 +5417,15 @@ MYBOOL set_callbacks(lprec *lp)
   lp->add_constraintex        = add_constraintex;
   lp->add_lag_con             = add_lag_con;
   lp->add_SOS                 = add_SOS;
+  lp->begin_update            = begin_update;
   lp->column_in_lp            = column_in_lp;
+  lp->commit_update           = commit_update;
   lp->copy_lp                 = copy_lp;
   lp->default_basis           = default_basis;
   lp->del_column              = del_column;
+  lp->del_columns_batch       = del_columns_batch;
   lp->del_constraint          = del_constraint;
+  lp->del_constraints_batch   = del_constraints_batch;
   lp->delete_lp               = delete_lp;
   lp->dualize_lp              = dualize_lp;
   lp->free_lp                 = free_lp;
@@ -5022,6 +5460,7 @@ MYBOOL set_callbacks(lprec *lp)
   lp->get_mat_byindex         = get_mat_byindex;
   lp->get_max_level           = get_max_level;
   lp->get_maxpivot            = get_maxpivot;
+  lp->get_memory_policy       = get_memory_policy;
   lp->get_mip_gap             = get_mip_gap;
   lp->get_multiprice          = get_multiprice;
   lp->get_nameindex           = get_nameindex;
@@ -5104,6 +5543,7 @@ MYBOOL set_callbacks(lprec *lp)
   lp->is_semicont             = is_semicont;
   lp->is_SOS_var              = is_SOS_var;
   lp->is_trace                = is_trace;
+  lp->load_model_csc          = load_model_csc;
   lp->lp_solve_version        = lp_solve_version;
   lp->make_lp                 = make_lp;
   lp->print_constraints       = print_constraints;
@@ -5161,8 +5601,10 @@ MYBOOL set_callbacks(lprec *lp)
   lp->set_lowbo               = set_lowbo;
   lp->set_lp_name             = set_lp_name;
   lp->set_mat                 = set_mat;
+  lp->set_mat_batch           = set_mat_batch;
   lp->set_maxim               = set_maxim;
   lp->set_maxpivot            = set_maxpivot;
+  lp->set_memory_policy       = set_memory_policy;
   lp->set_minim               = set_minim;
   lp->set_mip_gap             = set_mip_gap;
   lp->set_multiprice          = set_multiprice;
@@ -5923,7 +6365,8 @@ int __WINAPI get_lp_index(lprec *lp, int orig_index)
 MYBOOL __WINAPI is_feasible(lprec *lp, REAL *values, REAL threshold)
 /* Recommend to use threshold = lp->epspivot */
 {
-  int     i, j, elmnr, ie;
+  int     i, j;
+  NZINDEX elmnr, ie;
   REAL    *this_rhs, dist;
   REAL    *value;
   int     *rownr;
@@ -5963,8 +6406,9 @@ MYBOOL __WINAPI is_feasible(lprec *lp, REAL *values, REAL threshold)
 
 int __WINAPI column_in_lp(lprec *lp, REAL *testcolumn)
 {
-  int    i, j, je, colnr = 0;
+  int    i, colnr = 0;
   int    nz, ident = 1;
+  NZINDEX j, je;
   MATrec *mat = lp->matA;
   int    *matRownr;
   REAL   value, *matValue;
@@ -6459,7 +6903,8 @@ STATIC int row_decimals(lprec *lp, int rownr, MYBOOL intsonly, REAL *intscalar)
 STATIC int row_intstats(lprec *lp, int rownr, int pivcolnr, int *maxndec,
                         int *plucount, int *intcount, int *intval, REAL *valGCD, REAL *pivcolval)
 {
-  int    jb, je, jj, nn = 0, multA, multB, intGCD = 0;
+  int    jj, nn = 0, multA, multB, intGCD = 0;
+  NZINDEX jb, je;
   REAL   rowval, inthold, intfrac;
   MATrec *mat = lp->matA;
 
@@ -6478,7 +6923,7 @@ STATIC int row_intstats(lprec *lp, int rownr, int pivcolnr, int *maxndec,
       jb = mat->row_end[rownr-1];
       je = mat->row_end[rownr];
     }
-    nn = je - jb;
+    nn = (int) (je - jb);
     *pivcolval = 1.0;
     *plucount = 0;
     *intcount = 0;
@@ -6490,7 +6935,7 @@ STATIC int row_intstats(lprec *lp, int rownr, int pivcolnr, int *maxndec,
           nn--;
           continue;
         }
-        jj = jb;
+        jj = (int) jb;
       }
       else
         jj = ROW_MAT_COLNR(jb);
@@ -6498,7 +6943,7 @@ STATIC int row_intstats(lprec *lp, int rownr, int pivcolnr, int *maxndec,
       /* Pick up the value of the pivot column and continue */
       if(jj == pivcolnr) {
         if(rownr == 0)
-          *pivcolval = unscaled_mat(lp, lp->orig_obj[jb], 0, jb);
+          *pivcolval = unscaled_mat(lp, lp->orig_obj[jb], 0, jj);
         else
           *pivcolval = get_mat_byindex(lp, jb, TRUE, FALSE);
         continue;
@@ -6511,7 +6956,7 @@ STATIC int row_intstats(lprec *lp, int rownr, int pivcolnr, int *maxndec,
 
       /* Update the count of positive parameter values */
       if(rownr == 0)
-        rowval = unscaled_mat(lp, lp->orig_obj[jb], 0, jb);
+        rowval = unscaled_mat(lp, lp->orig_obj[jb], 0, jj);
       else
         rowval = get_mat_byindex(lp, jb, TRUE, FALSE);
       if(rowval > 0)
@@ -6733,8 +7178,9 @@ REAL MIP_stepOF(lprec *lp)
 STATIC REAL row_plusdelta(lprec *lp, int rownr, int excludecol, int *intcount, int *realcount)
 {
   MATrec   *mat = lp->matA;
-  int      j, jb, je, jj, bincount,
+  int      j, jb, jj, bincount,
            n = 0, nrows = lp->rows;
+  NZINDEX  ix, ib, ie;
   REAL     rowval, deltaOF = 0,
            *obj_orig = lp->orig_obj, *obj_sort = NULL;
 
@@ -6744,24 +7190,24 @@ STATIC REAL row_plusdelta(lprec *lp, int rownr, int excludecol, int *intcount, i
 
   /* Get OF row starting and ending positions, as well as the first column index */
   if(rownr == 0) {
-    jb = 1;
-    je = lp->columns+1;
+    ib = 1;
+    ie = lp->columns+1;
   }
   else {
-    jb = mat->row_end[rownr-1];
-    je = mat->row_end[rownr];
+    ib = mat->row_end[rownr-1];
+    ie = mat->row_end[rownr];
   }
 
   /* Fill the array */
-  for(j = jb; j < je; j++) {
+  for(ix = ib; ix < ie; ix++) {
 
     if(rownr == 0) {
-      if(obj_orig[j] == 0)
+      if(obj_orig[ix] == 0)
         continue;
-      jj = j;
+      jj = (int) ix;
     }
     else
-      jj = ROW_MAT_COLNR(j);
+      jj = ROW_MAT_COLNR(ix);
 
     /* Check for exclusion column */
     if(jj == excludecol)
@@ -6775,11 +7221,11 @@ STATIC REAL row_plusdelta(lprec *lp, int rownr, int excludecol, int *intcount, i
       if(rownr == 0)
         rowval = unscaled_mat(lp, obj_orig[jj], 0, jj);
       else
-        rowval = get_mat_byindex(lp, j, TRUE, FALSE);
+        rowval = get_mat_byindex(lp, ix, TRUE, FALSE);
 
       /* Allocate array of coefficients to be sorted */
       if(n == 0)
-        allocREAL(lp, &obj_sort, je-jb, FALSE);
+        allocREAL(lp, &obj_sort, ie-ib, FALSE);
 
       obj_sort[n++] = rowval;
     }
@@ -6865,8 +7311,8 @@ STATIC REAL MIP_stepOF(lprec *lp)
 
   if((lp->int_vars > 0) && (lp->solutionlimit == 1) && mat_validate(mat)) {
 
-    int colnr, ib, ie,
-        intcount, realcount;
+    int     colnr, intcount, realcount;
+    NZINDEX ib, ie;
 
     /* Get statistics for integer OF variables and compute base stepsize */
     OFdelta = row_plusdelta(lp, 0, 0, &intcount, &realcount);
@@ -7380,7 +7826,7 @@ STATIC int perturb_bounds(lprec *lp, BBrec *perturbed, MYBOOL doRows, MYBOOL doC
   ii = lp->rows;
   if(!doRows)
     i += ii;
-  if(!doCols)
+  if(doCols)
     ii = lp->sum;
 
  /* Perturb (expand) finite variable bounds randomly */
@@ -7420,6 +7866,44 @@ STATIC int perturb_bounds(lprec *lp, BBrec *perturbed, MYBOOL doRows, MYBOOL doC
   return( n );
 }
 
+/* Cost perturbation routine; the shifts are kept per variable in obj_perturb
+   and added to the active objective, so that removal is simply a matter of
+   discarding the vector and recomputing. */
+STATIC int perturb_costs(lprec *lp)
+{
+  int  i, j, n = 0;
+  REAL delta, cost;
+
+  if(!allocREAL(lp, &lp->obj_perturb, lp->columns + 1, TRUE))
+    return( n );
+
+  for(j = 1; j <= lp->columns; j++) {
+    i = lp->rows + j;
+
+    /* Fixed variables cannot contribute to dual degeneracy */
+    if(is_fixedvar(lp, i))
+      continue;
+
+    /* Size the shift relative to the cost, and randomize it to break ties */
+    cost   = lp->orig_obj[j];
+    delta  = rand_uniform(lp, 1.0) + 1;
+    delta *= lp->epsperturb * (1 + fabs(cost));
+
+    /* Structured direction: make the current nonbasic bound more attractive,
+       and otherwise push the cost away from zero */
+    if(!lp->is_basic[i] && !lp->is_lower[i])
+      delta = -delta;
+    else if(lp->is_basic[i] && (cost < 0))
+      delta = -delta;
+    lp->obj_perturb[j] = delta;
+    n++;
+  }
+
+  if(n == 0)
+    FREE(lp->obj_perturb);
+  return( n );
+}
+
 STATIC MYBOOL impose_bounds(lprec *lp, REAL *upbo, REAL *lowbo)
 /* Explicitly set working bounds to given vectors without pushing or popping */
 {
@@ -8405,10 +8889,16 @@ STATIC MYBOOL performiteration(lprec *lp, int rownr, int varin, LREAL theta, MYB
     if(!lp->obj_in_basis)
       hold[0] = 0; /* The correct reduced cost goes here (adjusted for bound state) ****** */
 
-    /* Update the RHS / basic variable values and set revised thetas */
+    /* Update the RHS / basic variable values and set revised thetas; the
+       entering step is recomputed from the updated leaving variable value */
     pivot = lp->bfp_pivotRHS(lp, 1, hold);
-    deltatheta = multi_enteringtheta(lp->longsteps);
-    theta = deltatheta;
+    if(prow != NULL) {
+      theta = prow[varin];
+      compute_theta(lp, rownr, &theta, enteringFromUB, 0, primal);
+    }
+    else
+      theta = multi_enteringtheta(lp->longsteps);
+    deltatheta = theta;
 
     FREE(hold);
   }
@@ -8826,6 +9316,7 @@ STATIC MYBOOL bb_better(lprec *lp, int target, int mode)
 STATIC void construct_solution(lprec *lp, REAL *target)
 {
   int     i, j, basi;
+  NZINDEX k, ke;
   REAL    f, epsvalue = lp->epsprimal;
   REAL    *solution;
   REAL    *value;
@@ -8896,12 +9387,12 @@ STATIC void construct_solution(lprec *lp, REAL *target)
     f = solution[lp->rows + j];
     if(f != 0) {
       solution[0] += f * unscaled_mat(lp, lp->orig_obj[j], 0, j);
-      i = mat->col_end[j-1];
-      basi = mat->col_end[j];
-      rownr = &COL_MAT_ROWNR(i);
-      value = &COL_MAT_VALUE(i);
-      for(; i < basi;
-          i++, rownr += matRowColStep, value += matValueStep)
+      k = mat->col_end[j-1];
+      ke = mat->col_end[j];
+      rownr = &COL_MAT_ROWNR(k);
+      value = &COL_MAT_VALUE(k);
+      for(; k < ke;
+          k++, rownr += matRowColStep, value += matValueStep)
         solution[*rownr] += f * unscaled_mat(lp, *value, *rownr, j);
     }
   }
@@ -9691,7 +10182,8 @@ STATIC void free_duals(lprec *lp)
    optionally rebase upper bound, and account for this in later calls */
 STATIC void initialize_solution(lprec *lp, MYBOOL shiftbounds)
 {
-  int     i, k1, k2, *matRownr, colnr;
+  int     i, *matRownr, colnr;
+  NZINDEX k1, k2;
   LREAL   theta;
   REAL    value, *matValue, loB, upB;
   MATrec  *mat = lp->matA;
@@ -9820,7 +10312,7 @@ STATIC void recompute_solution(lprec *lp, MYBOOL shiftbounds)
   initialize_solution(lp, shiftbounds);
 
   /* Compute x(b) = Inv(B)*RHS (Ref. lp_solve inverse logic and Chvatal p. 121) */
-  lp->bfp_ftran_normal(lp, lp->rhs, NULL);
+  ftran(lp, lp->rhs, NULL, lp->epsmachine);
   if(!lp->obj_in_basis) {
     int i, ib, n = lp->rows;
     for(i = 1; i <= n; i++) {
@@ -9919,7 +10411,8 @@ STATIC int verify_solution(lprec *lp, MYBOOL reinvert, char *info)
 /* Preprocessing and postprocessing functions */
 STATIC int identify_GUB(lprec *lp, MYBOOL mark)
 {
-  int    i, j, jb, je, k, knint, srh;
+  int    i, j, k, knint, srh;
+  NZINDEX jb, je;
   REAL   rh, mv, tv, bv;
   MATrec *mat = lp->matA;
 
@@ -9975,7 +10468,8 @@ STATIC int identify_GUB(lprec *lp, MYBOOL mark)
 
 STATIC int prepare_GUB(lprec *lp)
 {
-  int    i, j, jb, je, k, *members = NULL;
+  int    i, j, k, *members = NULL;
+  NZINDEX jb, je;
   REAL   rh;
   char   GUBname[16];
   MATrec *mat = lp->matA;
@@ -289,6 +289,11 @@
 #define CRASH_NONBASICBOUNDS     1
 #define CRASH_MOSTFEASIBLE       2
 #define CRASH_LEASTDEGENERATE    3
+#define CRASH_SIFTING            4
+#define CRASH_DECOMPOSE          5
+#define CRASH_NETWORK            6
+#define CRASH_BIXBY              7
+#define CRASH_LTSF               8
 
 /* Solution recomputation options (internal) */
 #define INITSOL_SHIFTZERO        0
@@ -308,6 +313,8 @@
 #define ANTIDEGEN_DURINGBB     128
 #define ANTIDEGEN_RHSPERTURB   256
 #define ANTIDEGEN_BOUNDFLIP    512
+#define ANTIDEGEN_COSTPERTURB 1024
+#define ANTIDEGEN_BOUNDSHIFT  2048
 #define ANTIDEGEN_DEFAULT        (ANTIDEGEN_FIXEDVARS | ANTIDEGEN_STALLING /* | ANTIDEGEN_INFEASIBLE */)
 
    /* REPORT defines */
@@ -417,9 +424,20 @@
 #define IMPROVE_DUALFEAS         2
 #define IMPROVE_THETAGAP         4
 #define IMPROVE_BBSIMPLEX        8
+#define IMPROVE_REFINE          16
 #define IMPROVE_DEFAULT          (IMPROVE_DUALFEAS + IMPROVE_THETAGAP)
 #define IMPROVE_INVERSE          (IMPROVE_SOLUTION + IMPROVE_THETAGAP)
 
+/* Memory allocation policies */
+#define MEMORY_DEFAULT           0
+#define MEMORY_ALIGNED           1   /* Align solver vectors to DEF_MEMORYALIGN bytes */
+#define MEMORY_HUGEPAGES         2   /* Also advise transparent huge pages for large vectors */
+#define MEMORY_VALUEMAP          4   /* Index the matrix values by a table of distinct values
+                                        in the product kernels while solving */
+#define MEMORY_HASHINDEX         8   /* Find elements in long matrix columns through a
+                                        coordinate hash, for heavy set_mat/get_mat use */
+#define MEMORY_ALLOCMASK         (MEMORY_ALIGNED + MEMORY_HUGEPAGES)
+
 /* Scaling types */
 #define SCALE_NONE               0
 #define SCALE_EXTREME            1
@@ -483,6 +501,7 @@
 #define PRICE_HARRISTWOPASS   4096    /* Use Harris' primal pivot logic rather than the default */
 #define PRICE_FORCEFULL       8192    /* Non-user option to force full pricing */
 #define PRICE_TRUENORMINIT   16384    /* Use true norms for Devex and Steepest Edge initializations */
+#define PRICE_NOLONGSTEP     32768    /* Disable the long-step (bound flipping) dual ratio test */
 
 /*#define _PRICE_NOBOUNDFLIP*/
 #if defined _PRICE_NOBOUNDFLIP
@@ -495,7 +514,8 @@
                                   PRICE_RANDOMIZE + PRICE_AUTOPARTIAL + PRICE_AUTOMULTIPLE + \
                                   PRICE_LOOPLEFT + PRICE_LOOPALTERNATE + \
                                   PRICE_HARRISTWOPASS + \
-                                  PRICE_FORCEFULL + PRICE_TRUENORMINIT)
+                                  PRICE_FORCEFULL + PRICE_TRUENORMINIT + \
+                                  PRICE_NOLONGSTEP)
 
 /* B&B active variable codes (internal) */
 #define BB_REAL                  0
@@ -528,6 +548,9 @@
 #define NODE_AUTOORDER        8192
 #define NODE_RCOSTFIXING     16384
 #define NODE_STRONGINIT      32768
+#define NODE_PROPAGATE       65536
+#define NODE_CONFLICTS      131072
+#define NODE_RCOSTGLOBAL    262144
 
 #define BRANCH_CEILING           0
 #define BRANCH_FLOOR             1
@@ -606,6 +629,11 @@
 #define DEF_MAXRELAX             7  /* Maximum number of non-BB relaxations in MILP */
 #define DEF_MAXPIVOTRETRY       10  /* Maximum number of times to retry a div-0 situation */
 #define DEF_MAXSINGULARITIES    10  /* Maximum number of singularities in refactorization */
+#define DEF_MEMORYALIGN         64  /* Byte alignment of solver vectors with MEMORY_ALIGNED */
+#define DEF_HUGEPAGELIMIT  4194304  /* Vectors of this many bytes or more get huge pages
+                                       with MEMORY_HUGEPAGES */
+#define DEF_REFINEMAX            3  /* Maximum number of iterative refinement steps per solve */
+#define DEF_REFINEREL       1.0e-03  /* Target refinement residual relative to epspivot */
 #define MAX_MINITUPDATES        60  /* Maximum number of bound swaps between refactorizations
 									   without recomputing the whole vector - contain errors */
 #define MIN_REFACTFREQUENCY      5  /* Refactorization frequency indicating an inherent
@@ -723,6 +751,8 @@
 #define DEF_LAGACCEPT      1.0e-03  /* Default Lagrangean convergence acceptance criterion */
 #define DEF_LAGCONTRACT       0.90  /* The contraction parameter for Lagrangean iterations */
 #define DEF_LAGMAXITERATIONS   100  /* The maximum number of Lagrangean iterations */
+#define DEF_LAGAGGREGATE      0.20  /* Weight of the newest subgradient in the aggregate direction */
+#define DEF_LAGTARGETGAP      0.10  /* Relative dual bound improvement targeted without a feasible value */
 
 #define DEF_PSEUDOCOSTUPDATES    7  /* The default number of times pseudo-costs are recalculated;
 									   experiments indicate that costs tend to stabilize */
@@ -827,11 +857,15 @@ typedef MYBOOL(__WINAPI add_constraint_func)(lprec *lp, REAL *row, int constr_ty
 typedef MYBOOL(__WINAPI add_constraintex_func)(lprec *lp, int count, REAL *row, int *colno, int constr_type, REAL rh);
 typedef MYBOOL(__WINAPI add_lag_con_func)(lprec *lp, REAL *row, int con_type, REAL rhs);
 typedef int (__WINAPI add_SOS_func)(lprec *lp, char *name, int sostype, int priority, int count, int *sosvars, REAL *weights);
+typedef MYBOOL(__WINAPI begin_update_func)(lprec *lp);
 typedef int (__WINAPI column_in_lp_func)(lprec *lp, REAL *column);
+typedef MYBOOL(__WINAPI commit_update_func)(lprec *lp);
 typedef lprec *(__WINAPI copy_lp_func)(lprec *lp);
 typedef void (__WINAPI default_basis_func)(lprec *lp);
 typedef MYBOOL(__WINAPI del_column_func)(lprec *lp, int colnr);
+typedef MYBOOL(__WINAPI del_columns_batch_func)(lprec *lp, int count, int *colnr);
 typedef MYBOOL(__WINAPI del_constraint_func)(lprec *lp, int rownr);
+typedef MYBOOL(__WINAPI del_constraints_batch_func)(lprec *lp, int count, int *rownr);
 typedef void (__WINAPI delete_lp_func)(lprec *lp);
 typedef MYBOOL(__WINAPI dualize_lp_func)(lprec *lp);
 typedef void (__WINAPI free_lp_func)(lprec **plp);
@@ -866,9 +900,10 @@ typedef int (__WINAPI get_lp_index_func)(lprec *lp, int orig_index);
 typedef char *(__WINAPI get_lp_name_func)(lprec *lp);
 typedef int (__WINAPI get_Lrows_func)(lprec *lp);
 typedef REAL(__WINAPI get_mat_func)(lprec *lp, int rownr, int colnr);
-typedef REAL(__WINAPI get_mat_byindex_func)(lprec *lp, int matindex, MYBOOL isrow, MYBOOL adjustsign);
+typedef REAL(__WINAPI get_mat_byindex_func)(lprec *lp, NZINDEX matindex, MYBOOL isrow, MYBOOL adjustsign);
 typedef int (__WINAPI get_max_level_func)(lprec *lp);
 typedef int (__WINAPI get_maxpivot_func)(lprec *lp);
+typedef int (__WINAPI get_memory_policy_func)(lprec *lp);
 typedef REAL(__WINAPI get_mip_gap_func)(lprec *lp, MYBOOL absolute);
 typedef int (__WINAPI get_multiprice_func)(lprec *lp, MYBOOL getabssize);
 typedef MYBOOL(__WINAPI is_use_names_func)(lprec *lp, MYBOOL isrow);
@@ -954,6 +989,7 @@ typedef MYBOOL(__WINAPI is_scaletype_func)(lprec *lp, int scaletype);
 typedef MYBOOL(__WINAPI is_semicont_func)(lprec *lp, int colnr);
 typedef MYBOOL(__WINAPI is_SOS_var_func)(lprec *lp, int colnr);
 typedef MYBOOL(__WINAPI is_trace_func)(lprec *lp);
+typedef MYBOOL(__WINAPI load_model_csc_func)(lprec *lp, int rows, int columns, NZINDEX *col_start, int *row_idx, REAL *values, REAL *lower, REAL *upper, REAL *obj, REAL *rhs, int *con_type, MYBOOL *is_int);
 typedef void (__WINAPI lp_solve_version_func)(int *majorversion, int *minorversion, int *release, int *build);
 typedef lprec *(__WINAPI make_lp_func)(int rows, int columns);
 typedef void (__WINAPI print_constraints_func)(lprec *lp, int columns);
@@ -1012,8 +1048,10 @@ typedef void (__WINAPI set_lag_trace_func)(lprec *lp, MYBOOL lag_trace);
 typedef MYBOOL(__WINAPI set_lowbo_func)(lprec *lp, int colnr, REAL value);
 typedef MYBOOL(__WINAPI set_lp_name_func)(lprec *lp, char *lpname);
 typedef MYBOOL(__WINAPI set_mat_func)(lprec *lp, int row, int column, REAL value);
+typedef MYBOOL(__WINAPI set_mat_batch_func)(lprec *lp, int count, int *rownr, int *colnr, REAL *values);
 typedef void (__WINAPI set_maxim_func)(lprec *lp);
 typedef void (__WINAPI set_maxpivot_func)(lprec *lp, int max_num_inv);
+typedef void (__WINAPI set_memory_policy_func)(lprec *lp, int policy);
 typedef void (__WINAPI set_minim_func)(lprec *lp);
 typedef void (__WINAPI set_mip_gap_func)(lprec *lp, MYBOOL absolute, REAL mip_gap);
 typedef MYBOOL(__WINAPI set_multiprice_func)(lprec *lp, int multiblockdiv);
@@ -1128,11 +1166,15 @@ struct _lprec
 	add_constraintex_func *add_constraintex;
 	add_lag_con_func *add_lag_con;
 	add_SOS_func *add_SOS;
+	begin_update_func *begin_update;
 	column_in_lp_func *column_in_lp;
+	commit_update_func *commit_update;
 	copy_lp_func *copy_lp;
 	default_basis_func *default_basis;
 	del_column_func *del_column;
+	del_columns_batch_func *del_columns_batch;
 	del_constraint_func *del_constraint;
+	del_constraints_batch_func *del_constraints_batch;
 	delete_lp_func *delete_lp;
 	dualize_lp_func *dualize_lp;
 	free_lp_func *free_lp;
@@ -1167,6 +1209,7 @@ struct _lprec
 	get_mat_byindex_func *get_mat_byindex;
 	get_max_level_func *get_max_level;
 	get_maxpivot_func *get_maxpivot;
+	get_memory_policy_func *get_memory_policy;
 	get_mip_gap_func *get_mip_gap;
 	get_multiprice_func *get_multiprice;
 	get_nameindex_func *get_nameindex;
@@ -1250,6 +1293,7 @@ struct _lprec
 	is_trace_func *is_trace;
 	is_unbounded_func *is_unbounded;
 	is_use_names_func *is_use_names;
+	load_model_csc_func *load_model_csc;
 	lp_solve_version_func *lp_solve_version;
 	make_lp_func *make_lp;
 	print_constraints_func *print_constraints;
@@ -1308,8 +1352,10 @@ struct _lprec
 	set_lowbo_func *set_lowbo;
 	set_lp_name_func *set_lp_name;
 	set_mat_func *set_mat;
+	set_mat_batch_func *set_mat_batch;
 	set_maxim_func *set_maxim;
 	set_maxpivot_func *set_maxpivot;
+	set_memory_policy_func *set_memory_policy;
 	set_minim_func *set_minim;
 	set_mip_gap_func *set_mip_gap;
 	set_multiprice_func *set_multiprice;
@@ -1398,6 +1444,13 @@ struct _lprec
 	MYBOOL    bb_trace;           /* TRUE to print extra debug information */
 	MYBOOL    streamowned;        /* TRUE if the handle should be closed at delete_lp() */
 	MYBOOL    obj_in_basis;       /* TRUE if the objective function is in the basis matrix */
+	MYBOOL    update_active;      /* TRUE between begin_update and commit_update */
+
+	int       update_count;       /* Number of constraint matrix changes queued by the update */
+	int       update_alloc;       /* Allocated size of the update queue */
+	int       *update_rownr;      /* update_alloc : Queued set_mat row indexes, ... */
+	int       *update_colnr;      /* ... column indexes and ... */
+	REAL      *update_value;      /* ... unscaled values, applied by set_mat_batch */
 
 	int       spx_status;         /* Simplex solver feasibility/mode code */
 	int       lag_status;         /* Extra status variable for lag_solve */
@@ -1413,6 +1466,7 @@ struct _lprec
 									 structured as the solution array above */
 	REAL *full_solution;     /* sum_alloc+1 : Final solution array expanded for deleted variables */
 	REAL *edgeVector;        /* Array of reduced cost scaling norms (DEVEX and Steepest Edge) */
+	REAL *edgeCache;         /* Saved true initial norms and the basis they were computed for */
 
 	REAL *drow;              /* sum+1: Reduced costs of the last simplex */
 	int *nzdrow;            /* sum+1: Indeces of non-zero reduced costs of the last simplex */
@@ -1430,6 +1484,7 @@ struct _lprec
 									 is at its from value of the last LP */
 	REAL *orig_obj;          /* Unused pointer - Placeholder for OF not part of B */
 	REAL *obj;               /* Special vector used to temporarily change the OF vector */
+	REAL *obj_perturb;       /* columns+1: Anti-degeneracy cost shifts added to the active OF */
 
 	COUNTER   current_iter;       /* Number of iterations in the current/last simplex */
 	COUNTER   total_iter;         /* Number of iterations over all B&B steps */
@@ -1460,11 +1515,13 @@ struct _lprec
 	REAL      scalelimit;         /* Relative convergence criterion for iterated scaling */
 	int       scalemode;          /* OR-ed codes for data scaling */
 	int       improve;            /* Set to non-zero for iterative improvement */
+	int       memory_policy;      /* MEMORY_ codes for allocating solver vectors */
 	int       anti_degen;         /* Anti-degen strategy (or none) TRUE to avoid cycling */
 	int       do_presolve;        /* PRESOLVE_ parameters for LP presolving */
 	int       presolveloops;      /* Maximum number of presolve loops */
 
 	int       perturb_count;      /* The number of bound relaxation retries performed */
+	int       refine_count;       /* The number of iterative refinement steps performed */
 
 	/* Row and column names storage variables */
 	hashelem **row_name;         /* rows_alloc+1 */
@@ -1605,6 +1662,8 @@ struct _lprec
 	int *bb_varactive;      /* The B&B state of the variable; 0 means inactive */
 	DeltaVrec *bb_upperchange;    /* Changes to upper bounds during the B&B phase */
 	DeltaVrec *bb_lowerchange;    /* Changes to lower bounds during the B&B phase */
+	BBproprec *bb_propagate;      /* Row activity tallies for B&B node bound propagation */
+	BBrcfrec  *bb_rcfglobal;      /* Root reduced costs for global B&B bound tightening */
 
 	REAL      bb_deltaOF;         /* Minimum OF step value; computed at beginning of solve() */
 
@@ -1796,6 +1855,7 @@ __EXTERN_C{
 
 	MYBOOL __EXPORT_TYPE __WINAPI del_constraint(lprec *lp, int rownr);
 	STATIC MYBOOL del_constraintex(lprec *lp, LLrec *rowmap);
+	MYBOOL __EXPORT_TYPE __WINAPI del_constraints_batch(lprec *lp, int count, int *rownr);
 	/* Remove constrain nr del_row from the problem */
 
 	MYBOOL __EXPORT_TYPE __WINAPI add_lag_con(lprec *lp, REAL *row, int con_type, REAL rhs);
@@ -1831,6 +1891,9 @@ __EXTERN_C{
 	MYBOOL __EXPORT_TYPE __WINAPI str_add_column(lprec *lp, char *col_string);
 	/* Add a column to the problem */
 
+	MYBOOL __EXPORT_TYPE __WINAPI load_model_csc(lprec *lp, int rows, int columns, NZINDEX *col_start, int *row_idx, REAL *values, REAL *lower, REAL *upper, REAL *obj, REAL *rhs, int *con_type, MYBOOL *is_int);
+	/* Load a complete model from compressed sparse column arrays into an empty lp */
+
 	MYBOOL __EXPORT_TYPE __WINAPI set_column(lprec *lp, int colnr, REAL *column);
 	MYBOOL __EXPORT_TYPE __WINAPI set_columnex(lprec *lp, int colnr, int count, REAL *column, int *rowno);
 	/* Overwrite existing column data */
@@ -1845,13 +1908,21 @@ __EXTERN_C{
 
 	MYBOOL __EXPORT_TYPE __WINAPI del_column(lprec *lp, int colnr);
 	STATIC MYBOOL del_columnex(lprec *lp, LLrec *colmap);
+	MYBOOL __EXPORT_TYPE __WINAPI del_columns_batch(lprec *lp, int count, int *colnr);
 	/* Delete a column */
 
 	MYBOOL __EXPORT_TYPE __WINAPI set_mat(lprec *lp, int rownr, int colnr, REAL value);
 	/* Fill in element (Row,Column) of the matrix
 	   Row in [0..Rows] and Column in [1..Columns] */
+	MYBOOL __EXPORT_TYPE __WINAPI set_mat_batch(lprec *lp, int count, int *rownr, int *colnr, REAL *values);
+	/* Fill in count elements (rownr[i],colnr[i]) as by set_mat, merged in a single pass */
+	MYBOOL __EXPORT_TYPE __WINAPI begin_update(lprec *lp);
+	MYBOOL __EXPORT_TYPE __WINAPI commit_update(lprec *lp);
+	/* Queue the constraint matrix changes of set_mat from begin_update on, and apply them
+	   in one merge at commit_update; queued changes are not seen by get_mat and friends
+	   until then.  Changes of rows or columns and solve apply the queue first */
 	REAL __EXPORT_TYPE __WINAPI get_mat(lprec *lp, int rownr, int colnr);
-	REAL __EXPORT_TYPE __WINAPI get_mat_byindex(lprec *lp, int matindex, MYBOOL isrow, MYBOOL adjustsign);
+	REAL __EXPORT_TYPE __WINAPI get_mat_byindex(lprec *lp, NZINDEX matindex, MYBOOL isrow, MYBOOL adjustsign);
 	int __EXPORT_TYPE __WINAPI get_nonzeros(lprec *lp);
 	/* get a single element from the matrix */  /* Name changed from "mat_elm" by KE */
 
@@ -2033,6 +2104,9 @@ __EXTERN_C{
    void __EXPORT_TYPE __WINAPI set_maxpivot(lprec *lp, int max_num_inv);
    int __EXPORT_TYPE __WINAPI get_maxpivot(lprec *lp);
 
+   void __EXPORT_TYPE __WINAPI set_memory_policy(lprec *lp, int policy);
+   int __EXPORT_TYPE __WINAPI get_memory_policy(lprec *lp);
+
    void __EXPORT_TYPE __WINAPI set_obj_bound(lprec *lp, REAL obj_bound);
    REAL __EXPORT_TYPE __WINAPI get_obj_bound(lprec *lp);
 
@@ -2184,6 +2258,7 @@ STATIC MYBOOL shift_rowcoldata(lprec *lp, int base, int delta, LLrec *usedmap, M
 STATIC MYBOOL shift_basis(lprec *lp, int base, int delta, LLrec *usedmap, MYBOOL isrow);
 STATIC MYBOOL shift_rowdata(lprec *lp, int base, int delta, LLrec *usedmap);
 STATIC MYBOOL shift_coldata(lprec *lp, int base, int delta, LLrec *usedmap);
+STATIC MYBOOL flush_update(lprec *lp);
 
 /* INLINE */ MYBOOL is_chsign(lprec *lp, int rownr);
 
@@ -2247,6 +2322,7 @@ STATIC MYBOOL verify_basis(lprec *lp);
 STATIC int unload_basis(lprec *lp, MYBOOL restorelast);
 
 STATIC int perturb_bounds(lprec *lp, BBrec *perturbed, MYBOOL doRows, MYBOOL doCols, MYBOOL includeFIXED);
+STATIC int perturb_costs(lprec *lp);
 STATIC MYBOOL validate_bounds(lprec *lp, REAL *upbo, REAL *lowbo);
 STATIC MYBOOL impose_bounds(lprec *lp, REAL *upbo, REAL *lowbo);
 STATIC int unload_BB(lprec *lp);
@@ -8,6 +8,10 @@
 #include "lp_pricePSE.h"
 #include "lp_matrix.h"
 
+#ifdef _OPENMP
+# include <omp.h>
+#endif
+
 #ifdef FORTIFY
 # include "lp_fortify.h"
 #endif
@@ -30,6 +34,27 @@
     v5.2.0  10 January 2005     Added fast deletion methods.
                                 Added data extraction to matrix method.
                                 Changed to explicit OF storage mode.
+    v5.2.1  17 October 2026     Added bulk loading of compressed sparse columns.
+    v5.2.2  17 October 2026     Reworked the row index rebuild as a blocked counting
+                                sort with optional OpenMP parallelism, and added
+                                incremental extension for appended columns.
+    v5.2.3  17 October 2026     Row index rebuild after element and column edits limited
+                                to the columns from the first edited one onward.
+    v5.2.4  17 October 2026     Added the value map of distinct element values with
+                                unit column flags for the product kernels.
+    v5.2.5  17 October 2026     Non-zero positions and counts typed as NZINDEX, which
+                                is 64-bit when compiled with NZINDEX64.
+    v5.2.6  17 October 2026     Added the coordinate hash for element lookups in long
+                                columns and the single pass batch merge mat_setbatch.
+    v5.2.7  17 October 2026     mat_colcompact optionally takes the column map of a
+                                mass deletion, so that empty columns are also dropped.
+    v5.2.8  17 October 2026     Element and column edits cut the row index back to the
+                                unchanged leading columns; mat_validate extends it once
+                                instead of every edit sweeping the index.  This is a
+                                deferred, partial rebuild: an edit in column 1 still
+                                means a full rebuild at the next mat_validate, since
+                                row_mat holds positions in the column storage and these
+                                move for all later columns on every insert or delete.
 
    ------------------------------------------------------------------------- */
 
@@ -85,13 +110,17 @@ STATIC void mat_free(MATrec **matrix)
   FREE((*matrix)->colmax);
   FREE((*matrix)->rowmax);
 
+  mat_vmapfree(*matrix);
+  mat_hashfree(*matrix);
+
   FREE(*matrix);
 }
 
-STATIC MYBOOL mat_memopt(MATrec *mat, int rowextra, int colextra, int nzextra)
+STATIC MYBOOL mat_memopt(MATrec *mat, int rowextra, int colextra, NZINDEX nzextra)
 {
-  MYBOOL status = TRUE;
-  int matalloc, colalloc, rowalloc;
+  MYBOOL  status = TRUE;
+  int     colalloc, rowalloc;
+  NZINDEX matalloc;
 
   if((mat == NULL) ||
 #if 0
@@ -122,12 +151,12 @@ STATIC MYBOOL mat_memopt(MATrec *mat, int rowextra, int colextra, int nzextra)
             allocINT(mat->lp,  &(mat->col_mat_rownr), matalloc, AUTOMATIC) &&
             allocREAL(mat->lp, &(mat->col_mat_value), matalloc, AUTOMATIC);
 #endif
-  status &= allocINT(mat->lp, &mat->col_end, colalloc, AUTOMATIC);
+  status &= allocNZINDEX(mat->lp, &mat->col_end, colalloc, AUTOMATIC);
   if(mat->col_tag != NULL)
     status &= allocINT(mat->lp, &mat->col_tag, colalloc, AUTOMATIC);
 
 #if MatrixRowAccess==RAM_Index
-  status &= allocINT(mat->lp, &(mat->row_mat), matalloc, AUTOMATIC);
+  status &= allocNZINDEX(mat->lp, &(mat->row_mat), matalloc, AUTOMATIC);
 #elif MatrixColAccess==CAM_Record
   mat->row_mat = (MATitem *) realloc(mat->row_mat, matalloc * sizeof(*(mat->row_mat)));
   status &= (mat->row_mat != NULL);
@@ -136,7 +165,7 @@ STATIC MYBOOL mat_memopt(MATrec *mat, int rowextra, int colextra, int nzextra)
             allocINT(mat->lp,  &(mat->row_mat_rownr), matalloc, AUTOMATIC) &&
             allocREAL(mat->lp, &(mat->row_mat_value), matalloc, AUTOMATIC);
 #endif
-  status &= allocINT(mat->lp, &mat->row_end, rowalloc, AUTOMATIC);
+  status &= allocNZINDEX(mat->lp, &mat->row_end, rowalloc, AUTOMATIC);
   if(mat->row_tag != NULL)
     status &= allocINT(mat->lp, &mat->row_tag, rowalloc, AUTOMATIC);
 
@@ -148,9 +177,9 @@ STATIC MYBOOL mat_memopt(MATrec *mat, int rowextra, int colextra, int nzextra)
   return( status );
 }
 
-STATIC MYBOOL inc_mat_space(MATrec *mat, int mindelta)
+STATIC MYBOOL inc_mat_space(MATrec *mat, NZINDEX mindelta)
 {
-  int spaceneeded, nz = mat_nonzeros(mat);
+  NZINDEX spaceneeded, nz = mat_nonzeros(mat);
 
   if(mindelta <= 0)
     mindelta = MAX(mat->rows, mat->columns) + 1;
@@ -180,7 +209,7 @@ STATIC MYBOOL inc_mat_space(MATrec *mat, int mindelta)
 #endif
 
 #if MatrixRowAccess==RAM_Index
-    allocINT(mat->lp, &(mat->row_mat), mat->mat_alloc, AUTOMATIC);
+    allocNZINDEX(mat->lp, &(mat->row_mat), mat->mat_alloc, AUTOMATIC);
 #elif MatrixColAccess==CAM_Record
     mat->row_mat = (MATitem *) realloc(mat->row_mat, (mat->mat_alloc) * sizeof(*(mat->row_mat)));
 #else /*if MatrixColAccess==CAM_Vector*/
@@ -202,13 +231,13 @@ STATIC MYBOOL inc_matrow_space(MATrec *mat, int deltarows)
 
     /* Update memory allocation and sizes */
     oldrowsalloc = mat->rows_alloc;
-    deltarows = DELTA_SIZE(deltarows, mat->rows);
+    deltarows = (int) DELTA_SIZE(deltarows, mat->rows);
     SETMAX(deltarows, DELTAROWALLOC);
     mat->rows_alloc += deltarows;
     rowsum = mat->rows_alloc + 1;
 
     /* Update row pointers */
-    status = allocINT(mat->lp, &mat->row_end, rowsum, AUTOMATIC);
+    status = allocNZINDEX(mat->lp, &mat->row_end, rowsum, AUTOMATIC);
     mat->row_end_valid = FALSE;
   }
   return( status );
@@ -224,11 +253,11 @@ STATIC MYBOOL inc_matcol_space(MATrec *mat, int deltacols)
 
     /* Update memory allocation and sizes */
     oldcolsalloc = mat->columns_alloc;
-    deltacols = DELTA_SIZE(deltacols, mat->columns);
+    deltacols = (int) DELTA_SIZE(deltacols, mat->columns);
     SETMAX(deltacols, DELTACOLALLOC);
     mat->columns_alloc += deltacols;
     colsum = mat->columns_alloc + 1;
-    status = allocINT(mat->lp, &mat->col_end, colsum, AUTOMATIC);
+    status = allocNZINDEX(mat->lp, &mat->col_end, colsum, AUTOMATIC);
 
     /* Update column pointers */
     if(oldcolsalloc == 0)
@@ -242,27 +271,27 @@ STATIC MYBOOL inc_matcol_space(MATrec *mat, int deltacols)
 
 STATIC int mat_collength(MATrec *mat, int colnr)
 {
-  return( mat->col_end[colnr] - mat->col_end[colnr-1] );
+  return( (int) (mat->col_end[colnr] - mat->col_end[colnr-1]) );
 }
 
 STATIC int mat_rowlength(MATrec *mat, int rownr)
 {
   if(mat_validate(mat)) {
     if(rownr <= 0)
-      return( mat->row_end[0] );
+      return( (int) mat->row_end[0] );
     else
-      return( mat->row_end[rownr] - mat->row_end[rownr-1] );
+      return( (int) (mat->row_end[rownr] - mat->row_end[rownr-1]) );
   }
   else
     return( 0 );
 }
 
-STATIC int mat_nonzeros(MATrec *mat)
+STATIC NZINDEX mat_nonzeros(MATrec *mat)
 {
   return( mat->col_end[mat->columns] );
 }
 
-STATIC MYBOOL mat_indexrange(MATrec *mat, int index, MYBOOL isrow, int *startpos, int *endpos)
+STATIC MYBOOL mat_indexrange(MATrec *mat, int index, MYBOOL isrow, NZINDEX *startpos, NZINDEX *endpos)
 {
 #ifdef Paranoia
   if(isrow && ((index < 0) || (index > mat->rows)))
@@ -287,12 +316,15 @@ STATIC MYBOOL mat_indexrange(MATrec *mat, int index, MYBOOL isrow, int *startpos
 
 STATIC int mat_shiftrows(MATrec *mat, int *bbase, int delta, LLrec *varmap)
 {
-  int     j, k, i, ii, thisrow, *colend, base;
+  int     j, thisrow, base;
+  NZINDEX i, ii, k, *colend;
   MYBOOL  preparecompact = FALSE;
   int     *rownr;
 
   if(delta == 0)
     return( 0 );
+  mat->row_end_cols = 0;
+  mat->vmap_cols = 0;
   base = abs(*bbase);
 
   if(delta > 0) {
@@ -331,11 +363,10 @@ STATIC int mat_shiftrows(MATrec *mat, int *bbase, int delta, LLrec *varmap)
         else
           newrowidx[j] = -1;
       }
-      k = 0;
       delta = 0;
-      base = mat_nonzeros(mat);
+      k = mat_nonzeros(mat);
       rownr = &COL_MAT_ROWNR(0);
-      for(i = 0; i < base; i++, rownr += matRowColStep) {
+      for(i = 0; i < k; i++, rownr += matRowColStep) {
         thisrow = newrowidx[*rownr];
         if(thisrow < 0) {
           *rownr = -1;
@@ -409,9 +440,10 @@ STATIC int mat_shiftrows(MATrec *mat, int *bbase, int delta, LLrec *varmap)
    When mat2 is NULL, a simple compacting of non-deleted rows and columns is done. */
 STATIC int mat_mapreplace(MATrec *mat, LLrec *rowmap, LLrec *colmap, MATrec *mat2)
 {
-  lprec *lp = mat->lp;
-  int   i, ib, ie, ii, j, jj, jb, je, nz, *colend, *rownr, *rownr2, *indirect = NULL;
-  REAL  *value, *value2;
+  lprec   *lp = mat->lp;
+  int     i, j, jj, *rownr, *rownr2, *indirect = NULL;
+  NZINDEX ib, ie, ii, jb, je, nz, *colend;
+  REAL    *value, *value2;
 
   /* Check if there is something to insert */
   if((mat2 != NULL) && ((mat2->col_tag == NULL) || (mat2->col_tag[0] <= 0) || (mat_nonzeros(mat2) == 0)))
@@ -429,6 +461,8 @@ STATIC int mat_mapreplace(MATrec *mat, LLrec *rowmap, LLrec *colmap, MATrec *mat
 
   /* Do the compacting */
   mat->row_end_valid = FALSE;
+  mat->row_end_cols = 0;
+  mat->vmap_cols = 0;
   nz = mat->col_end[mat->columns];
   ie = 0;
   ii = 0;
@@ -577,7 +611,7 @@ Finish:
   nz -= mat->col_end[mat->columns];
   FREE(indirect);
 
-  return( nz );
+  return( (int) nz );
 }
 
 /* Routines to compact rows in matrix based on precoded entries */
@@ -587,8 +621,12 @@ STATIC int mat_zerocompact(MATrec *mat)
 }
 STATIC int mat_rowcompact(MATrec *mat, MYBOOL dozeros)
 {
-  int  i, ie, ii, j, nn, *colend, *rownr;
-  REAL *value;
+  int     j, nn, *rownr;
+  NZINDEX i, ie, ii, *colend;
+  REAL    *value;
+
+  mat->row_end_cols = 0;
+  mat->vmap_cols = 0;
 
   nn = 0;
   ie = 0;
@@ -615,14 +653,18 @@ STATIC int mat_rowcompact(MATrec *mat, MYBOOL dozeros)
   return( nn );
 }
 
-/* Routines to compact columns and their indeces based on precoded entries */
-STATIC int mat_colcompact(MATrec *mat, int prev_rows, int prev_cols)
+/* Routines to compact columns and their indeces based on precoded entries;
+   with a column map, deleted columns are taken from the map rather than the marks */
+STATIC int mat_colcompact(MATrec *mat, int prev_rows, int prev_cols, LLrec *colmap)
 {
-  int             i, ii, j, k, n_del, n_sum, *colend, *newcolend, *colnr, newcolnr;
+  int             j, n_del, n_sum, *colnr, newcolnr;
+  NZINDEX         i, ii, k, *colend, *newcolend;
   MYBOOL          deleted;
   lprec           *lp = mat->lp;
   presolveundorec *lpundo = lp->presolve_undo;
 
+  mat->row_end_cols = 0;
+  mat->vmap_cols = 0;
 
   n_sum = 0;
   k  = 0;
@@ -650,12 +692,15 @@ STATIC int mat_colcompact(MATrec *mat, int prev_rows, int prev_cols)
     }
     *newcolend = ii;
 
-    deleted = (MYBOOL) (n_del > 0);
+    if(colmap != NULL)
+      deleted = (MYBOOL) !isActiveLink(colmap, j);
+    else {
+      deleted = (MYBOOL) (n_del > 0);
 #if 1
-    /* Do hoops in case there was an empty column */
-    deleted |= (MYBOOL) (!lp->wasPresolved && (lpundo->var_to_orig[prev_rows+j] < 0));
-
+      /* Do hoops in case there was an empty column */
+      deleted |= (MYBOOL) (!lp->wasPresolved && (lpundo->var_to_orig[prev_rows+j] < 0));
 #endif
+    }
     /* Increment column variables if current column was not deleted */
     if(!deleted) {
       newcolend++;
@@ -667,13 +712,20 @@ STATIC int mat_colcompact(MATrec *mat, int prev_rows, int prev_cols)
 
 STATIC int mat_shiftcols(MATrec *mat, int *bbase, int delta, LLrec *varmap)
 {
-  int     i, ii, k, n, base;
+  int     base;
+  NZINDEX i, ii, k, n;
 
 
   k = 0;
   if(delta == 0)
-    return( k );
+    return( 0 );
   base = abs(*bbase);
+  if((delta < 0) || (base <= mat->columns))
+    mat->row_end_cols = 0;
+  if(varmap != NULL)
+    mat->vmap_cols = 0;
+  else
+    SETMIN(mat->vmap_cols, base - 1);
 
   if(delta > 0) {
     /* Shift pointers right */
@@ -693,7 +745,8 @@ STATIC int mat_shiftcols(MATrec *mat, int *bbase, int delta, LLrec *varmap)
     MYBOOL preparecompact = (MYBOOL) (varmap != NULL);
     if(preparecompact) {
       /* Create the offset array */
-      int j, *colnr, *colend;
+      int     j, jj, *colnr;
+      NZINDEX *colend;
       n = 0;
       k = 0;
       base = 0;
@@ -703,17 +756,17 @@ STATIC int mat_shiftcols(MATrec *mat, int *bbase, int delta, LLrec *varmap)
         k = *colend;
         if(isActiveLink(varmap, j)) {
           base++;
-          ii = base;
+          jj = base;
         }
         else
-          ii = -1;
-        if(ii < 0)
+          jj = -1;
+        if(jj < 0)
           n += k - i;
         colnr = &COL_MAT_COLNR(i);
         for(; i < k; i++, colnr += matRowColStep)
-          *colnr = ii;
+          *colnr = jj;
       }
-      return(n);
+      return( (int) n );
     }
 
     /* Check if we should prepare for compacting later
@@ -760,14 +813,15 @@ STATIC int mat_shiftcols(MATrec *mat, int *bbase, int delta, LLrec *varmap)
       }
     }
   }
-  return( k );
+  return( (int) k );
 }
 
 STATIC MATrec *mat_extractmat(MATrec *mat, LLrec *rowmap, LLrec *colmap, MYBOOL negated)
 {
-  int    *rownr, *colnr, xa, na;
-  REAL   *value;
-  MATrec *newmat = mat_create(mat->lp, mat->rows, mat->columns, mat->epsvalue);
+  int     *rownr, *colnr;
+  NZINDEX xa, na;
+  REAL    *value;
+  MATrec  *newmat = mat_create(mat->lp, mat->rows, mat->columns, mat->epsvalue);
 
   /* Initialize */
   na = mat_nonzeros(mat);
@@ -790,10 +844,11 @@ STATIC MATrec *mat_extractmat(MATrec *mat, LLrec *rowmap, LLrec *colmap, MYBOOL
 
 STATIC MYBOOL mat_setcol(MATrec *mat, int colno, int count, REAL *column, int *rowno, MYBOOL doscale, MYBOOL checkrowmode)
 {
-  int    i, jj = 0, elmnr, orignr, newnr, firstrow;
-  MYBOOL *addto = NULL, isA, isNZ;
-  REAL   value, saved = 0;
-  lprec  *lp = mat->lp;
+  int     i, elmnr, orignr, newnr, firstrow;
+  NZINDEX jj = 0, tail;
+  MYBOOL  *addto = NULL, isA, isNZ;
+  REAL    value, saved = 0;
+  lprec   *lp = mat->lp;
 
   /* Check if we are in row order mode and should add as row instead;
      the matrix will be transposed at a later stage */
@@ -876,9 +931,9 @@ STATIC MYBOOL mat_setcol(MATrec *mat, int colno, int count, REAL *column, int *r
   /* Shift existing column data and adjust position indeces */
   orignr = mat_collength(mat, colno);
   elmnr = newnr - orignr;
-  i = mat_nonzeros(mat) - mat->col_end[colno];
-  if((elmnr != 0) && (i > 0)) {
-    COL_MAT_MOVE(mat->col_end[colno] + elmnr, mat->col_end[colno], i);
+  tail = mat_nonzeros(mat) - mat->col_end[colno];
+  if((elmnr != 0) && (tail > 0)) {
+    COL_MAT_MOVE(mat->col_end[colno] + elmnr, mat->col_end[colno], tail);
   }
   if(elmnr != 0)
     for(i = colno; i <= mat->columns; i++)
@@ -931,7 +986,9 @@ STATIC MYBOOL mat_setcol(MATrec *mat, int colno, int count, REAL *column, int *r
       jj++;
     }
   }
-  mat->row_end_valid = FALSE;
+
+  SETMIN(mat->vmap_cols, colno - 1);
+  mat_rowmapcut(mat, colno);
 
   /* Finish and return */
 Done:
@@ -983,7 +1040,7 @@ STATIC MYBOOL mat_mergemat(MATrec *target, MATrec *source, MYBOOL usecolmap)
   return( TRUE );
 }
 
-STATIC int mat_nz_unused(MATrec *mat)
+STATIC NZINDEX mat_nz_unused(MATrec *mat)
 {
   return( mat->mat_alloc - mat->col_end[mat->columns] );
 }
@@ -1372,6 +1429,8 @@ STATIC MYBOOL mat_setrow(MATrec *mat, int rowno, int count, REAL *row, int *coln
   if(matz > 0)
     mat_zerocompact(mat);
   mat->row_end_valid = FALSE;
+  mat->row_end_cols = 0;
+  mat->vmap_cols = 0;
 
 Done:
   if(saved != 0)
@@ -1387,9 +1446,10 @@ STATIC MYBOOL mat_setrow(MATrec *mat, int rowno, int count, REAL *row, int *coln
 {
   lprec   *lp = mat->lp;
   int     delta, delta1;
-  int k, i, ii, j, jj_j, lendense,
-          origidx = 0, newidx, orignz, newnz,
+  int     k, lendense, newnz,
           rownr, colnr, colnr1;
+  NZINDEX i, ii, j, jj_j,
+          origidx = 0, newidx, orignz;
   MYBOOL  isA, isNZ;
   REAL    value = 0.0;
 
@@ -1440,14 +1500,14 @@ STATIC MYBOOL mat_setrow(MATrec *mat, int rowno, int count, REAL *row, int *coln
     if(!allocINT(lp, &colno, lendense+1, FALSE))
       return( FALSE );
     newnz = 0;
-    for(i = 1; i <= lendense; i++)
-      if((value = row[i]) != 0) {
-        if((tmprow == NULL) && !allocREAL(lp, &tmprow, lendense-i+1, FALSE)) {
+    for(k = 1; k <= lendense; k++)
+      if((value = row[k]) != 0) {
+        if((tmprow == NULL) && !allocREAL(lp, &tmprow, lendense-k+1, FALSE)) {
           FREE(colno);
           return( FALSE );
         }
         tmprow[newnz] = value;
-        colno[newnz++] = i;
+        colno[newnz++] = k;
       }
     count = newnz;
     row = tmprow;
@@ -1471,7 +1531,7 @@ STATIC MYBOOL mat_setrow(MATrec *mat, int rowno, int count, REAL *row, int *coln
   /* Make sure we have enough matrix space */
   i  = mat->row_end[rowno-1];
   ii = mat->row_end[rowno];
-  delta1 = delta = count - (ii-i);
+  delta1 = delta = count - (int) (ii-i);
   colnr1 = (newnz > 0 ? colno[0] : lendense+1);
 
   /* Pack initial entries if existing row data has a lower column
@@ -1499,7 +1559,7 @@ STATIC MYBOOL mat_setrow(MATrec *mat, int rowno, int count, REAL *row, int *coln
       /* Update next column start index */
       mat->col_end[j] = newidx;
     }
-    delta = newidx - origidx;  /* The first stage element shrinkage count */
+    delta = (int) (newidx - origidx);  /* The first stage element shrinkage count */
   }
   else {
     delta = 0;
@@ -1513,7 +1573,7 @@ STATIC MYBOOL mat_setrow(MATrec *mat, int rowno, int count, REAL *row, int *coln
   j = !((orignz == lendense) && (newnz == orignz) && (delta1 == 0)) && (jj_j > 0) && (orignz > origidx);
 
   if ((j) && (jj_j > delta1))
-    delta1 = jj_j;
+    delta1 = (int) jj_j;
 
   if((delta1 > 0) && (mat_nz_unused(mat) <= delta1) && !inc_mat_space(mat, delta1)) {
     newnz = 0;
@@ -1610,6 +1670,8 @@ ForceDelete:
   for(; k <= lendense; k++)
     mat->col_end[k] = jj_j;
   mat->row_end_valid = FALSE;
+  mat->row_end_cols = 0;
+  mat->vmap_cols = 0;
 
 Done:
   if(!isNZ)
@@ -1622,10 +1684,11 @@ Done:
 
 STATIC int mat_appendrow(MATrec *mat, int count, REAL *row, int *colno, REAL mult, MYBOOL checkrowmode)
 {
-  int    i, j, jj = 0, stcol, elmnr, orignr, newnr, firstcol;
-  MYBOOL *addto = NULL, isA, isNZ;
-  REAL   value, saved = 0;
-  lprec  *lp = mat->lp;
+  int     j, jj = 0, newnr, firstcol;
+  NZINDEX i, stcol, elmnr, orignr;
+  MYBOOL  *addto = NULL, isA, isNZ;
+  REAL    value, saved = 0;
+  lprec   *lp = mat->lp;
 
   /* Check if we are in row order mode and should add as column instead;
      the matrix will be transposed at a later stage */
@@ -1633,6 +1696,8 @@ STATIC int mat_appendrow(MATrec *mat, int count, REAL *row, int *colno, REAL mul
     return( mat_appendcol(mat, count, row, colno, mult, FALSE) );
 
   /* Do initialization and validation */
+  mat->row_end_cols = 0;
+  mat->vmap_cols = 0;
   isA = (MYBOOL) (mat == lp->matA);
   isNZ = (MYBOOL) (colno != NULL);
   if(isNZ && (count > 0)) {
@@ -1688,10 +1753,10 @@ STATIC int mat_appendrow(MATrec *mat, int count, REAL *row, int *colno, REAL mul
       if(!allocMYBOOL(lp, &addto, mat->columns + 1, TRUE)) {
         return( newnr );
       }
-      for(i = mat->columns; i >= 1; i--) {
-        if(fabs(row[i]) > mat->epsvalue) {
-          addto[i] = TRUE;
-          firstcol = i;
+      for(j = mat->columns; j >= 1; j--) {
+        if(fabs(row[j]) > mat->epsvalue) {
+          addto[j] = TRUE;
+          firstcol = j;
           newnr++;
         }
       }
@@ -1757,7 +1822,8 @@ Done:
 
 STATIC int mat_appendcol(MATrec *mat, int count, REAL *column, int *rowno, REAL mult, MYBOOL checkrowmode)
 {
-  int     i, row, elmnr, lastnr;
+  int     i, row, lastnr;
+  NZINDEX elmnr;
   REAL    value;
   MYBOOL  isA, isNZ;
   lprec   *lp = mat->lp;
@@ -1767,6 +1833,11 @@ STATIC int mat_appendcol(MATrec *mat, int count, REAL *column, int *rowno, REAL
   if(checkrowmode && mat->is_roworder)
     return( mat_appendrow(mat, count, column, rowno, mult, FALSE) );
 
+  /* Keep any row index of the preceding columns for incremental extension */
+  if(mat->columns <= mat->row_end_cols)
+    mat->row_end_cols = 0;
+  SETMIN(mat->vmap_cols, mat->columns - 1);
+
   /* Make sure we have enough space */
 /*
   if(!inc_mat_space(mat, mat->rows+1))
@@ -1783,7 +1854,7 @@ STATIC int mat_appendcol(MATrec *mat, int count, REAL *column, int *rowno, REAL
     for(i = 1; i <= nrows; i++)
       if(column[i] != 0)
         elmnr++;
-    i = elmnr;
+    i = (int) elmnr;
   }
   if((mat_nz_unused(mat) <= i) && !inc_mat_space(mat, i))
     return( 0 );
@@ -1847,13 +1918,82 @@ STATIC int mat_appendcol(MATrec *mat, int count, REAL *column, int *rowno, REAL
  /* Set end of data */
   mat->col_end[mat->columns] = elmnr;
 
-  return( mat->col_end[mat->columns] - mat->col_end[mat->columns-1] );
+  return( mat_collength(mat, mat->columns) );
+}
+
+STATIC NZINDEX mat_appendcsc(MATrec *mat, int count, NZINDEX *col_start, int *row_idx, REAL *values)
+/* Bulk version of mat_appendcol that fills the last "count" (already allocated and
+   empty) columns directly from compressed sparse column arrays; the non-zero storage
+   is sized once and the row map is rebuilt in a single counting pass at the end */
+{
+  int     j, row, lastnr, base;
+  NZINDEX i, ie, elmnr;
+  REAL    value;
+  MYBOOL  isA, doscale;
+  lprec   *lp = mat->lp;
+
+  base = mat->columns - count;
+  if(mat->is_roworder || (count <= 0) || (base < 0))
+    return( 0 );
+  if(base < mat->row_end_cols)
+    mat->row_end_cols = 0;
+  SETMIN(mat->vmap_cols, base);
+
+  i = col_start[count] - col_start[0];
+  if((mat_nz_unused(mat) <= i) && !inc_mat_space(mat, i))
+    return( -1 );
+
+  isA = (MYBOOL) (mat == lp->matA);
+  doscale = (MYBOOL) (isA && lp->scaling_used);
+
+  /* Copy column by column; the row indexes must be ascending within each column */
+  elmnr = mat->col_end[base];
+  for(j = 1; j <= count; j++) {
+    ie = col_start[j];
+    lastnr = -1;
+    for(i = col_start[j-1]; i < ie; i++) {
+      row = row_idx[i];
+      if((row <= lastnr) || (row > mat->rows)) {
+        for(; j <= count; j++)
+          mat->col_end[base + j] = elmnr;
+        mat->row_end_valid = FALSE;
+        return( -1 );
+      }
+      lastnr = row;
+      value = values[i];
+      if(fabs(value) <= mat->epsvalue)
+        continue;
+#ifdef DoMatrixRounding
+      value = roundToPrecision(value, mat->epsvalue);
+#endif
+      if(isA) {
+        value = my_chsign(is_chsign(lp, row), value);
+        if(doscale)
+          value = scaled_mat(lp, value, row, base + j);
+        if(row == 0) {
+          lp->orig_obj[base + j] = value;
+          continue;
+        }
+      }
+      SET_MAT_ijA(elmnr, row, base + j, value);
+      elmnr++;
+    }
+    mat->col_end[base + j] = elmnr;
+  }
+
+  /* Build the row-order index in one pass */
+  mat->row_end_valid = FALSE;
+  if(!mat_validate(mat))
+    return( -1 );
+
+  return( elmnr - mat->col_end[base] );
 }
 
 STATIC int mat_checkcounts(MATrec *mat, int *rownum, int *colnum, MYBOOL freeonexit)
 {
-  int i, j, n;
-  int *rownr;
+  int     i, n;
+  NZINDEX j, je;
+  int     *rownr;
 
   if(rownum == NULL)
     allocINT(mat->lp, &rownum, mat->rows + 1, TRUE);
@@ -1862,9 +2002,9 @@ STATIC int mat_checkcounts(MATrec *mat, int *rownum, int *colnum, MYBOOL freeone
 
   for(i = 1 ; i <= mat->columns; i++) {
     j = mat->col_end[i - 1];
-    n = mat->col_end[i];
+    je = mat->col_end[i];
     rownr = &COL_MAT_ROWNR(j);
-    for(; j < n;
+    for(; j < je;
         j++, rownr += matRowColStep) {
       colnum[i]++;
       rownum[*rownr]++;
@@ -1874,11 +2014,11 @@ STATIC int mat_checkcounts(MATrec *mat, int *rownum, int *colnum, MYBOOL freeone
   n = 0;
   if((mat->lp->do_presolve != PRESOLVE_NONE) &&
      (mat->lp->spx_trace || (mat->lp->verbose > NORMAL))) {
-    for(j = 1; j <= mat->columns; j++)
-      if(colnum[j] == 0) {
+    for(i = 1; i <= mat->columns; i++)
+      if(colnum[i] == 0) {
         n++;
         report(mat->lp, FULL, "mat_checkcounts: Variable %s is not used in any constraints\n",
-                              get_col_name(mat->lp, j));
+                              get_col_name(mat->lp, i));
       }
     for(i = 0; i <= mat->rows; i++)
       if(rownum[i] == 0) {
@@ -1897,54 +2037,199 @@ STATIC int mat_checkcounts(MATrec *mat, int *rownum, int *colnum, MYBOOL freeone
 
 }
 
-STATIC MYBOOL mat_validate(MATrec *mat)
-/* Routine to make sure that row mapping arrays are valid */
+STATIC MYBOOL mat_rowmapbuild(MATrec *mat)
+/* Rebuild the row mapping arrays with a two-pass counting sort; the columns are
+   split into blocks of about equal non-zero counts with one row histogram each,
+   so that both the tally and the scatter pass can run in parallel */
 {
-  int     i, j, je, *rownum;
+  int     b, nb, i, ie, rows = mat->rows, *blockcol = NULL;
+  NZINDEX j, je, nz, *rownum = NULL, *count;
   int     *rownr, *colnr;
 
-  if(!mat->row_end_valid) {
+  nz = mat_nonzeros(mat);
+  nb = 1;
+#ifdef _OPENMP
+  if(nz >= MAT_PARALLELNZ)
+    nb = MAX(1, MIN(omp_get_max_threads(), mat->columns));
+#endif
+  if(!allocINT(mat->lp, &blockcol, nb + 1, FALSE) ||
+     !allocNZINDEX(mat->lp, &rownum, (NZINDEX) nb * (rows + 1), TRUE)) {
+    FREE(blockcol);
+    return( FALSE );
+  }
 
-    MEMCLEAR(mat->row_end, mat->rows + 1);
-    allocINT(mat->lp, &rownum, mat->rows + 1, TRUE);
+  /* Split the columns into blocks with similar numbers of non-zeros */
+  blockcol[0] = 0;
+  for(b = 1, i = 0; b < nb; b++) {
+    je = (NZINDEX) ((REAL) nz * b / nb);
+    while((i < mat->columns) && (mat->col_end[i] < je))
+      i++;
+    blockcol[b] = i;
+  }
+  blockcol[nb] = mat->columns;
 
-    /* First tally row counts and then cumulate them */
-    j = mat_nonzeros(mat);
-    rownr = &COL_MAT_ROWNR(0);
-    for(i = 0; i < j; i++, rownr += matRowColStep)
-      mat->row_end[*rownr]++;
-    for(i = 1; i <= mat->rows; i++)
-      mat->row_end[i] += mat->row_end[i - 1];
+  /* First tally the row counts of each block */
+#ifdef _OPENMP
+#pragma omp parallel for private(j, je, rownr, count) if(nb > 1)
+#endif
+  for(b = 0; b < nb; b++) {
+    count = rownum + b * (rows + 1);
+    j  = mat->col_end[blockcol[b]];
+    je = mat->col_end[blockcol[b + 1]];
+    rownr = &COL_MAT_ROWNR(j);
+    for(; j < je; j++, rownr += matRowColStep)
+      count[*rownr]++;
+  }
 
-    /* Calculate the column index for every non-zero */
-    for(i = 1; i <= mat->columns; i++) {
-      j = mat->col_end[i - 1];
+  /* Then cumulate them into the starting position of every row in every block */
+  j = 0;
+  for(i = 0; i <= rows; i++) {
+    for(b = 0, count = rownum + i; b < nb; b++, count += rows + 1) {
+      je = *count;
+      *count = j;
+      j += je;
+    }
+    mat->row_end[i] = j;
+  }
+
+  /* Finally scatter the column index of every non-zero into its row position */
+#ifdef _OPENMP
+#pragma omp parallel for private(i, ie, j, je, rownr, colnr, count) if(nb > 1)
+#endif
+  for(b = 0; b < nb; b++) {
+    count = rownum + b * (rows + 1);
+    ie = blockcol[b + 1];
+    for(i = blockcol[b] + 1; i <= ie; i++) {
+      j  = mat->col_end[i - 1];
       je = mat->col_end[i];
       rownr = &COL_MAT_ROWNR(j);
       colnr = &COL_MAT_COLNR(j);
       for(; j < je; j++, rownr += matRowColStep, colnr += matRowColStep) {
-#ifdef Paranoia
-        if(/*(*colnr < 0) || (*colnr > mat->columns) || (Normally violated in primal phase 1) */
-           (*rownr < 0) || (*rownr > mat->rows)) {
-          report(mat->lp, SEVERE, "mat_validate: Matrix value storage error row %d [0..%d], column %d [1..%d]\n",
-                                  *rownr, mat->rows, *colnr, mat->columns);
-          mat->lp->spx_status = UNKNOWNERROR;
-          return(FALSE);
-        }
-#endif
         *colnr = i;
-        if(*rownr == 0)
-          mat_set_rowmap(mat, rownum[*rownr],
-                              *rownr, i, j);
-        else
-          mat_set_rowmap(mat, mat->row_end[*rownr - 1] + rownum[*rownr],
-                              *rownr, i, j);
-        rownum[*rownr]++;
+        mat_set_rowmap(mat, count[*rownr]++, *rownr, i, j);
       }
     }
+  }
+
+  FREE(rownum);
+  FREE(blockcol);
+  return( TRUE );
+}
+
+STATIC MYBOOL mat_rowmapappend(MATrec *mat)
+/* Extend row mapping arrays that are still valid for the leading columns with the
+   non-zeros of the columns appended or edited since; the stale entries of edited
+   columns are dropped first, then the existing row segments are moved up
+   in place and the new entries are placed behind them, preserving column order */
+{
+#if MatrixRowAccess==RAM_Index
+  int     i, firstcol = mat->row_end_cols;
+  NZINDEX j, je, n, nz, oldnz = mat->row_end_nz, *rownum = NULL;
+  int     *rownr, *colnr;
+
+  /* Only do this if a minority of the non-zeros is new */
+  nz = mat_nonzeros(mat);
+  if((firstcol <= 0) || (firstcol > mat->columns) ||
+     (mat->col_end[firstcol] != oldnz) || (nz - oldnz > oldnz) ||
+     !allocNZINDEX(mat->lp, &rownum, mat->rows + 1, TRUE))
+    return( FALSE );
+
+  /* Drop the entries of the columns that were edited since the index was built;
+     nothing is moved before the first dropped entry */
+  if(mat->row_end[mat->rows] > oldnz) {
+    n = 0;
+    j = 0;
+    for(i = 0; i <= mat->rows; i++) {
+      je = mat->row_end[i];
+      for(; j < je; j++)
+        if(mat->row_mat[j] < oldnz) {
+          if(n < j)
+            mat->row_mat[n] = mat->row_mat[j];
+          n++;
+        }
+      mat->row_end[i] = n;
+    }
+  }
+
+  /* Tally the row counts of the new non-zeros */
+  rownr = &COL_MAT_ROWNR(oldnz);
+  for(j = oldnz; j < nz; j++, rownr += matRowColStep)
+    rownum[*rownr]++;
+
+  /* Move the existing row segments up by the number of new entries in the
+     rows before them, and store the insertion position after each segment */
+  n = nz - oldnz;
+  for(i = mat->rows; i >= 0; i--) {
+    je = mat->row_end[i];
+    j  = (i == 0 ? 0 : mat->row_end[i - 1]);
+    mat->row_end[i] = je + n;
+    n -= rownum[i];
+    if((n > 0) && (je > j))
+      MEMMOVE(mat->row_mat + j + n, mat->row_mat + j, je - j);
+    rownum[i] = je + n;
+  }
+
+  /* Place the new entries */
+  for(i = firstcol + 1; i <= mat->columns; i++) {
+    j  = mat->col_end[i - 1];
+    je = mat->col_end[i];
+    rownr = &COL_MAT_ROWNR(j);
+    colnr = &COL_MAT_COLNR(j);
+    for(; j < je; j++, rownr += matRowColStep, colnr += matRowColStep) {
+      *colnr = i;
+      mat_set_rowmap(mat, rownum[*rownr]++, *rownr, i, j);
+    }
+  }
+
+  FREE(rownum);
+  return( TRUE );
+#else
+  return( FALSE );
+#endif
+}
+
+STATIC void mat_rowmapcut(MATrec *mat, int colnr)
+/* Invalidate the row mapping arrays after an element was inserted into or deleted
+   from column colnr, but keep them marked as valid for the leading columns, whose
+   positions did not move; mat_validate then drops the entries of the later columns
+   and extends the index with them once, however many edits were made since.  The
+   index is not patched in place, so the cost of that rebuild grows with the number
+   of non-zeros in and after column colnr, not with the length of the edited row */
+{
+  mat->row_end_valid = FALSE;
+  if(colnr <= mat->row_end_cols) {
+    mat->row_end_cols = colnr - 1;
+    mat->row_end_nz = mat->col_end[colnr - 1];
+  }
+}
+
+STATIC MYBOOL mat_validate(MATrec *mat)
+/* Routine to make sure that row mapping arrays are valid */
+{
+  if(!mat->row_end_valid) {
+
+#ifdef Paranoia
+    NZINDEX i, j;
+    int     *rownr;
+
+    j = mat_nonzeros(mat);
+    rownr = &COL_MAT_ROWNR(0);
+    for(i = 0; i < j; i++, rownr += matRowColStep)
+      if((*rownr < 0) || (*rownr > mat->rows)) {
+        report(mat->lp, SEVERE, "mat_validate: Matrix value storage error row %d [0..%d], element %.0f\n",
+                                *rownr, mat->rows, (double) i);
+        mat->lp->spx_status = UNKNOWNERROR;
+        return(FALSE);
+      }
+#endif
+
+    /* Extend the row index if columns were only appended, otherwise rebuild it */
+    if(!mat_rowmapappend(mat) && !mat_rowmapbuild(mat))
+      return( FALSE );
 
-    FREE(rownum);
     mat->row_end_valid = TRUE;
+    mat->row_end_cols = mat->columns;
+    mat->row_end_nz = mat_nonzeros(mat);
   }
 
   if(mat == mat->lp->matA)
@@ -1952,7 +2237,174 @@ STATIC MYBOOL mat_validate(MATrec *mat)
   return( TRUE );
 }
 
-MYBOOL mat_get_data(lprec *lp, int matindex, MYBOOL isrow, int **rownr, int **colnr, REAL **value)
+STATIC MYBOOL mat_vmapbuild(MATrec *mat)
+/* Pack the element values into a table of the distinct values with a one or two
+   byte index per element, and flag the columns that only hold +1 or only -1; the
+   product kernels then stream these instead of col_mat_value.  The map covers the
+   current columns and is cut back to the unchanged leading columns when the matrix
+   is edited, so columns appended later simply use col_mat_value. */
+{
+  lprec   *lp = mat->lp;
+  int     j, lo, hi;
+  NZINDEX i, ie, nz = mat_nonzeros(mat), size;
+  REAL    *value, *table = NULL;
+
+  mat_vmapfree(mat);
+  if(mat->is_roworder || (nz == 0))
+    return( FALSE );
+
+  /* Collect the sorted distinct values */
+  if(!allocREAL(lp, &table, nz, FALSE))
+    return( FALSE );
+  MEMCOPY(table, &COL_MAT_VALUE(0), nz);
+  qsort(table, nz, sizeof(*table), compareREAL);
+  size = 1;
+  for(i = 1; i < nz; i++)
+    if(table[i] != table[size-1])
+      table[size++] = table[i];
+  if(size > MAT_VMAPMAXSIZE) {
+    FREE(table);
+    return( FALSE );
+  }
+  if(!allocREAL(lp, &table, size, AUTOMATIC))
+    return( FALSE );
+  mat->vmap_value = table;
+  mat->vmap_size = (int) size;
+
+  /* Index each element by bisection in the value table */
+  if(size <= 256)
+    mat->vmap_index8 = (unsigned char *) malloc(nz * sizeof(*mat->vmap_index8));
+  else
+    mat->vmap_index16 = (unsigned short *) malloc(nz * sizeof(*mat->vmap_index16));
+  mat->vmap_unit = (signed char *) malloc((mat->columns + 1) * sizeof(*mat->vmap_unit));
+  if(((mat->vmap_index8 == NULL) && (mat->vmap_index16 == NULL)) || (mat->vmap_unit == NULL)) {
+    report(lp, CRITICAL, "mat_vmapbuild: Could not allocate the value map for %.0f elements\n", (double) nz);
+    mat_vmapfree(mat);
+    return( FALSE );
+  }
+  value = &COL_MAT_VALUE(0);
+  for(i = 0; i < nz; i++, value += matValueStep) {
+    lo = 0;
+    hi = mat->vmap_size - 1;
+    while(lo < hi) {
+      j = (lo + hi) / 2;
+      if(table[j] < *value)
+        lo = j + 1;
+      else
+        hi = j;
+    }
+    if(mat->vmap_index8 != NULL)
+      mat->vmap_index8[i] = (unsigned char) lo;
+    else
+      mat->vmap_index16[i] = (unsigned short) lo;
+  }
+
+  /* Flag the pure +1 and -1 columns */
+  mat->vmap_unit[0] = 0;
+  for(j = 1; j <= mat->columns; j++) {
+    i = mat->col_end[j - 1];
+    ie = mat->col_end[j];
+    lo = 0;
+    if(i < ie) {
+      value = &COL_MAT_VALUE(i);
+      if(fabs(*value) == 1)
+        lo = (*value > 0 ? 1 : -1);
+      for(; (lo != 0) && (i < ie); i++, value += matValueStep)
+        if(*value != lo)
+          lo = 0;
+    }
+    mat->vmap_unit[j] = (signed char) lo;
+  }
+  mat->vmap_cols = mat->columns;
+
+  return( TRUE );
+}
+
+STATIC void mat_vmapfree(MATrec *mat)
+{
+  FREE(mat->vmap_value);
+  FREE(mat->vmap_index8);
+  FREE(mat->vmap_index16);
+  FREE(mat->vmap_unit);
+  mat->vmap_cols = 0;
+  mat->vmap_size = 0;
+}
+
+#define MAT_HASHKEY(row, col, mask) ((NZINDEX) (((unsigned int) (row) * 2654435761u) ^ \
+                                                ((unsigned int) (col) * 40503u)) & (mask))
+
+STATIC MYBOOL mat_hashbuild(MATrec *mat)
+/* Index the positions of the elements in columns of at least MAT_HASHMINLEN
+   elements by their (row, column) coordinates, using linear probing in a table
+   of at least twice that size; shorter columns are cheaper to search directly */
+{
+  int     j;
+  NZINDEX i, ie, h, nz = mat_nonzeros(mat), count = 0, size = 1;
+
+  mat_hashfree(mat);
+  mat->elm_hashnz = nz;
+  for(j = 1; j <= mat->columns; j++)
+    if(mat_collength(mat, j) >= MAT_HASHMINLEN)
+      count += mat_collength(mat, j);
+  if(count == 0)
+    return( FALSE );
+  while(size < 2*count)
+    size *= 2;
+  if(!allocNZINDEX(mat->lp, &(mat->elm_hash), size, TRUE))
+    return( FALSE );
+  mat->elm_hashmask = size - 1;
+
+  for(j = 1; j <= mat->columns; j++) {
+    if(mat_collength(mat, j) < MAT_HASHMINLEN)
+      continue;
+    ie = mat->col_end[j];
+    for(i = mat->col_end[j - 1]; i < ie; i++) {
+      h = MAT_HASHKEY(COL_MAT_ROWNR(i), j, mat->elm_hashmask);
+      while(mat->elm_hash[h] != 0)
+        h = (h + 1) & mat->elm_hashmask;
+      mat->elm_hash[h] = i + 1;
+    }
+  }
+  return( TRUE );
+}
+
+STATIC void mat_hashfree(MATrec *mat)
+{
+  FREE(mat->elm_hash);
+  mat->elm_hashmask = 0;
+  mat->elm_hashstale = 0;
+}
+
+STATIC NZINDEX mat_hashfind(MATrec *mat, int row, int column, NZINDEX low, NZINDEX high)
+/* Return the position of the element through the coordinate hash, or -1 if it has
+   to be searched for.  The hash is not updated by matrix edits; every hit is checked
+   to lie in the low..high position range of the column and to hold the row (the
+   stored column numbers can be stale until mat_validate), so shifted entries fall back
+   to the search, and the hash is rebuilt once MAT_HASHREBUILD lookups have been made
+   after an edit that changed the non-zero count */
+{
+  NZINDEX h, pos, nz = mat_nonzeros(mat);
+
+  if(mat->elm_hashnz != nz) {
+    mat->elm_hashstale++;
+    if((mat->elm_hash != NULL) && ((NZINDEX) mat->elm_hashstale * MAT_HASHREBUILD < nz))
+      return( -1 );
+    mat_hashbuild(mat);
+  }
+  if(mat->elm_hash == NULL)
+    return( -1 );
+
+  h = MAT_HASHKEY(row, column, mat->elm_hashmask);
+  while((pos = mat->elm_hash[h]) != 0) {
+    pos--;
+    if((pos >= low) && (pos <= high) && (COL_MAT_ROWNR(pos) == row))
+      return( pos );
+    h = (h + 1) & mat->elm_hashmask;
+  }
+  return( -1 );
+}
+
+MYBOOL mat_get_data(lprec *lp, NZINDEX matindex, MYBOOL isrow, int **rownr, int **colnr, REAL **value)
 {
   MATrec *mat = lp->matA;
 
@@ -1990,7 +2442,7 @@ MYBOOL mat_get_data(lprec *lp, int matindex, MYBOOL isrow, int **rownr, int **co
 }
 
 
-MYBOOL mat_set_rowmap(MATrec *mat, int row_mat_index, int rownr, int colnr, int col_mat_index)
+MYBOOL mat_set_rowmap(MATrec *mat, NZINDEX row_mat_index, int rownr, int colnr, NZINDEX col_mat_index)
 {
 #if MatrixRowAccess == RAM_Index
   mat->row_mat[row_mat_index] = col_mat_index;
@@ -2011,9 +2463,10 @@ MYBOOL mat_set_rowmap(MATrec *mat, int row_mat_index, int rownr, int colnr, int
 }
 
 /* Implement combined binary/linear sub-search for matrix look-up */
-int mat_findelm(MATrec *mat, int row, int column)
+NZINDEX mat_findelm(MATrec *mat, int row, int column)
 {
-  int low, high, mid, item;
+  NZINDEX low, high, mid;
+  int     item;
 
 #if 0
   if(mat->row_end_valid && (row > 0) &&
@@ -2035,6 +2488,11 @@ int mat_findelm(MATrec *mat, int row, int column)
   if(low > high)
     return( -2 );
 
+ /* Try the coordinate hash for long columns */
+  if((mat->lp->memory_policy & MEMORY_HASHINDEX) && (high - low >= MAT_HASHMINLEN - 1) &&
+     ((mid = mat_hashfind(mat, row, column, low, high)) >= 0))
+    return( mid );
+
  /* Do binary search logic */
   mid = (low+high) / 2;
   item = COL_MAT_ROWNR(mid);
@@ -2072,9 +2530,10 @@ int mat_findelm(MATrec *mat, int row, int column)
     return( -2 );
 }
 
-int mat_findins(MATrec *mat, int row, int column, int *insertpos, MYBOOL validate)
+NZINDEX mat_findins(MATrec *mat, int row, int column, NZINDEX *insertpos, MYBOOL validate)
 {
-  int low, high, mid, item, exitvalue, insvalue;
+  NZINDEX low, high, mid, exitvalue, insvalue;
+  int     item;
 
 #if 0
   if(mat->row_end_valid && (row > 0) &&
@@ -2116,6 +2575,14 @@ int mat_findins(MATrec *mat, int row, int column, int *insertpos, MYBOOL validat
     goto Done;
   }
 
+ /* Try the coordinate hash for long columns */
+  if((mat->lp->memory_policy & MEMORY_HASHINDEX) && (high - low >= MAT_HASHMINLEN - 1) &&
+     ((mid = mat_hashfind(mat, row, column, low, high)) >= 0)) {
+    insvalue = mid;
+    exitvalue = mid;
+    goto Done;
+  }
+
  /* Do binary search logic */
   mid = (low+high) / 2;
   item = COL_MAT_ROWNR(mid);
@@ -2164,7 +2631,7 @@ Done:
 
 STATIC REAL mat_getitem(MATrec *mat, int row, int column)
 {
-  int elmnr;
+  NZINDEX elmnr;
 
 #ifdef DirectOverrideOF
   if((row == 0) && (mat == mat->lp->matA) && (mat->lp->OF_override != NULL))
@@ -2182,7 +2649,7 @@ STATIC REAL mat_getitem(MATrec *mat, int row, int column)
 
 STATIC MYBOOL mat_additem(MATrec *mat, int row, int column, REAL delta)
 {
-  int elmnr;
+  NZINDEX elmnr;
 
 #ifdef DirectOverrideOF
   if((row == 0) && (mat == mat->lp->matA) && (mat->lp->OF_override != NULL))
@@ -2190,6 +2657,7 @@ STATIC MYBOOL mat_additem(MATrec *mat, int row, int column, REAL delta)
   else
 #endif
   {
+    SETMIN(mat->vmap_cols, column - 1);
     elmnr = mat_findelm(mat, row, column);
     if(elmnr >= 0) {
       COL_MAT_VALUE(elmnr) += delta;
@@ -2209,7 +2677,7 @@ STATIC MYBOOL mat_setitem(MATrec *mat, int row, int column, REAL value)
 
 STATIC void mat_multrow(MATrec *mat, int row_nr, REAL mult)
 {
-  int i, k1, k2;
+  NZINDEX i, k1, k2;
 
 #if 0
   if(row_nr == 0) {
@@ -2226,6 +2694,7 @@ STATIC void mat_multrow(MATrec *mat, int row_nr, REAL mult)
       k1 = 0;
     else
 #else
+  mat->vmap_cols = 0;
   if(mat_validate(mat)) {
     if(row_nr == 0)
       k1 = 0;
@@ -2240,8 +2709,8 @@ STATIC void mat_multrow(MATrec *mat, int row_nr, REAL mult)
 
 STATIC void mat_multcol(MATrec *mat, int col_nr, REAL mult, MYBOOL DoObj)
 {
-  int    i, ie;
-  MYBOOL isA;
+  NZINDEX i, ie;
+  MYBOOL  isA;
 
 #ifdef Paranoia
   if((col_nr < 1) || (col_nr > mat->columns)) {
@@ -2254,6 +2723,7 @@ STATIC void mat_multcol(MATrec *mat, int col_nr, REAL mult, MYBOOL DoObj)
 
   isA = (MYBOOL) (mat == mat->lp->matA);
 
+  SETMIN(mat->vmap_cols, col_nr - 1);
   ie = mat->col_end[col_nr];
   for(i = mat->col_end[col_nr - 1]; i < ie; i++)
     COL_MAT_VALUE(i) *= mult;
@@ -2268,7 +2738,8 @@ STATIC void mat_multcol(MATrec *mat, int col_nr, REAL mult, MYBOOL DoObj)
 STATIC void mat_multadd(MATrec *mat, REAL *lhsvector, int varnr, REAL mult)
 {
   int               colnr;
-  register int      ib, ie, *matRownr;
+  register NZINDEX  ib, ie;
+  register int      *matRownr;
   register REAL     *matValue;
 
   /* Handle case of a slack variable */
@@ -2302,8 +2773,9 @@ STATIC void mat_multadd(MATrec *mat, REAL *lhsvector, int varnr, REAL mult)
 
 STATIC MYBOOL mat_setvalue(MATrec *mat, int Row, int Column, REAL Value, MYBOOL doscale)
 {
-  int    elmnr, lastelm, i, RowA = Row, ColumnA = Column;
-  MYBOOL isA;
+  int     i, RowA = Row, ColumnA = Column;
+  NZINDEX k, elmnr, lastelm;
+  MYBOOL  isA;
 
   /* This function is inefficient if used to add new matrix entries in
      other places than at the end of the matrix. OK for replacing existing
@@ -2329,14 +2801,15 @@ STATIC MYBOOL mat_setvalue(MATrec *mat, int Row, int Column, REAL Value, MYBOOL
   }
 
   /* Find out if we already have such an entry, or return insertion point */
-  i = mat_findins(mat, Row, Column, &elmnr, FALSE);
-  if(i == -1)
+  k = mat_findins(mat, Row, Column, &elmnr, FALSE);
+  if(k == -1)
     return(FALSE);
 
   if(isA)
     set_action(&mat->lp->spx_action, ACTION_REBASE | ACTION_RECOMPUTE | ACTION_REINVERT);
+  SETMIN(mat->vmap_cols, Column - 1);
 
-  if(i >= 0) {
+  if(k >= 0) {
     /* there is an existing entry */
     if(fabs(Value) > mat->epsvalue) { /* we replace it by something non-zero */
       if(isA) {
@@ -2353,8 +2826,8 @@ STATIC MYBOOL mat_setvalue(MATrec *mat, int Row, int Column, REAL Value, MYBOOL
       /* Shift up tail end of the matrix */
       lastelm = mat_nonzeros(mat);
 #if 0
-      for(i = elmnr; i < lastelm ; i++) {
-        COL_MAT_COPY(i, i + 1);
+      for(k = elmnr; k < lastelm ; k++) {
+        COL_MAT_COPY(k, k + 1);
       }
 #else
       lastelm -= elmnr;
@@ -2363,7 +2836,7 @@ STATIC MYBOOL mat_setvalue(MATrec *mat, int Row, int Column, REAL Value, MYBOOL
       for(i = Column; i <= mat->columns; i++)
         mat->col_end[i]--;
 
-      mat->row_end_valid = FALSE;
+      mat_rowmapcut(mat, Column);
     }
   }
   else if(fabs(Value) > mat->epsvalue) {
@@ -2383,8 +2856,8 @@ STATIC MYBOOL mat_setvalue(MATrec *mat, int Row, int Column, REAL Value, MYBOOL
     /* Shift down tail end of the matrix by one */
     lastelm = mat_nonzeros(mat);
 #if 1 /* Does compiler optimization work better here? */
-    for(i = lastelm; i > elmnr ; i--) {
-      COL_MAT_COPY(i, i - 1);
+    for(k = lastelm; k > elmnr ; k--) {
+      COL_MAT_COPY(k, k - 1);
     }
 #else
     lastelm -= elmnr - 1;
@@ -2403,7 +2876,7 @@ STATIC MYBOOL mat_setvalue(MATrec *mat, int Row, int Column, REAL Value, MYBOOL
     for(i = Column; i <= mat->columns; i++)
       mat->col_end[i]++;
 
-    mat->row_end_valid = FALSE;
+    mat_rowmapcut(mat, Column);
   }
 
   if(isA && (mat->lp->var_is_free != NULL) && (mat->lp->var_is_free[ColumnA] > 0))
@@ -2411,9 +2884,178 @@ STATIC MYBOOL mat_setvalue(MATrec *mat, int Row, int Column, REAL Value, MYBOOL
   return(TRUE);
 }
 
+STATIC MYBOOL mat_setbatch(MATrec *mat, int count, int *rowno, int *colno, REAL *values)
+/* Set a batch of elements, given in storage coordinates with final (scaled and sign
+   adjusted) values, in one merge with the column storage:
+
+    1: Two counting sorts order the batch by column and row; being stable, the last
+       of any duplicate coordinates wins, as with successive mat_setvalue calls
+    2: A forward sweep replaces and deletes existing elements, compacting as it goes
+    3: A backward sweep inserts the new elements, expanding from the end
+
+   Each sweep starts at the first column in the batch, so the cost is linear in the
+   batch and the matrix tail instead of a tail shift per inserted element.  As in
+   mat_setvalue, values not exceeding epsvalue delete the element. */
+{
+  lprec   *lp = mat->lp;
+  int     i, j, t, tb, te, firstcol, lastcol, *order = NULL, *work = NULL, *start = NULL;
+  NZINDEX k, kb, w, nz, ninsert, ndelete;
+  REAL    value;
+  MYBOOL  status = FALSE, restructured;
+
+  if(count <= 0)
+    return( TRUE );
+  if(!allocINT(lp, &order, count, FALSE) ||
+     !allocINT(lp, &work, count, FALSE) ||
+     !allocINT(lp, &start, MAX(mat->rows, mat->columns) + 2, TRUE))
+    goto Finish;
+
+  /* Sort the batch stably by row, and then by column */
+  for(t = 0; t < count; t++)
+    start[rowno[t] + 1]++;
+  for(i = 1; i <= mat->rows + 1; i++)
+    start[i] += start[i - 1];
+  for(t = 0; t < count; t++)
+    work[start[rowno[t]]++] = t;
+  MEMCLEAR(start, mat->columns + 2);
+  for(t = 0; t < count; t++)
+    start[colno[t] + 1]++;
+  for(j = 1; j <= mat->columns + 1; j++)
+    start[j] += start[j - 1];
+  for(t = 0; t < count; t++)
+    order[start[colno[work[t]]]++] = work[t];
+
+  /* Keep the last of duplicate coordinates; the batch elements of column j are then
+     order[start[j-1]..start[j]-1], with start[0] = 0 */
+  firstcol = 0;
+  lastcol = 0;
+  tb = 0;
+  i = 0;
+  for(j = 1; j <= mat->columns; j++) {
+    te = start[j];
+    for(t = tb; t < te; t++) {
+      if((t + 1 < te) && (rowno[order[t + 1]] == rowno[order[t]]))
+        continue;
+      order[i++] = order[t];
+    }
+    tb = te;
+    start[j] = i;
+    if(start[j] > start[j - 1]) {
+      if(firstcol == 0)
+        firstcol = j;
+      lastcol = j;
+    }
+  }
+  if(firstcol == 0) {
+    status = TRUE;
+    goto Finish;
+  }
+
+  /* Replace and delete existing elements, flagging the batch elements to insert */
+  nz = mat_nonzeros(mat);
+  ninsert = 0;
+  ndelete = 0;
+  k = mat->col_end[firstcol - 1];
+  w = k;
+  for(j = firstcol; j <= lastcol; j++) {
+    kb = mat->col_end[j];
+    t = start[j - 1];
+    te = start[j];
+    for(; k < kb; k++) {
+      i = COL_MAT_ROWNR(k);
+      for(; (t < te) && (rowno[order[t]] < i); t++) {
+        work[t] = (MYBOOL) (fabs(values[order[t]]) > mat->epsvalue);
+        ninsert += work[t];
+      }
+      if((t < te) && (rowno[order[t]] == i)) {
+        work[t] = FALSE;
+        value = values[order[t++]];
+        if(fabs(value) <= mat->epsvalue) {
+          ndelete++;
+          continue;
+        }
+#ifdef DoMatrixRounding
+        value = roundToPrecision(value, mat->epsvalue);
+#endif
+        COL_MAT_VALUE(k) = value;
+      }
+      if(w < k) {
+        COL_MAT_COPY(w, k);
+      }
+      w++;
+    }
+    for(; t < te; t++) {
+      work[t] = (MYBOOL) (fabs(values[order[t]]) > mat->epsvalue);
+      ninsert += work[t];
+    }
+    mat->col_end[j] = w;
+  }
+  if(ndelete > 0) {
+    COL_MAT_MOVE(w, k, nz - k);
+    for(j = lastcol + 1; j <= mat->columns; j++)
+      mat->col_end[j] -= ndelete;
+  }
+  restructured = (MYBOOL) (ndelete + ninsert > 0);
+
+  /* Insert the new elements, moving the columns up from the end */
+  if(ninsert > 0) {
+    if(!inc_mat_space(mat, ninsert))
+      goto Finish;
+    nz = mat_nonzeros(mat);
+    k = mat->col_end[lastcol];
+    COL_MAT_MOVE(k + ninsert, k, nz - k);
+    for(j = mat->columns; j > lastcol; j--)
+      mat->col_end[j] += ninsert;
+    for(j = lastcol; (j >= firstcol) && (ninsert > 0); j--) {
+      kb = mat->col_end[j - 1];
+      k = mat->col_end[j] - 1;
+      mat->col_end[j] += ninsert;
+      w = k + ninsert;
+      tb = start[j - 1];
+      for(t = start[j] - 1; t >= tb; t--) {
+        if(!work[t])
+          continue;
+        i = rowno[order[t]];
+        for(; (k >= kb) && (COL_MAT_ROWNR(k) > i); k--, w--) {
+          COL_MAT_COPY(w, k);
+        }
+        value = values[order[t]];
+#ifdef DoMatrixRounding
+        value = roundToPrecision(value, mat->epsvalue);
+#endif
+        SET_MAT_ijA(w, i, j, value);
+        w--;
+        ninsert--;
+      }
+      if(w > k)
+        for(; k >= kb; k--, w--) {
+          COL_MAT_COPY(w, k);
+        }
+    }
+  }
+
+  /* Structural changes invalidate the row index; plain replacements keep it */
+  if(lp->matA == mat)
+    set_action(&lp->spx_action, ACTION_REBASE | ACTION_RECOMPUTE | ACTION_REINVERT);
+  SETMIN(mat->vmap_cols, firstcol - 1);
+  if(restructured) {
+    mat->row_end_valid = FALSE;
+    if(firstcol <= mat->row_end_cols)
+      mat->row_end_cols = 0;
+  }
+  status = TRUE;
+
+Finish:
+  FREE(order);
+  FREE(work);
+  FREE(start);
+  return( status );
+}
+
 STATIC MYBOOL mat_appendvalue(MATrec *mat, int Row, REAL Value)
 {
-  int *elmnr, Column = mat->columns;
+  int     Column = mat->columns;
+  NZINDEX *elmnr;
 
   /* Set small numbers to zero */
   if(fabs(Value) < mat->epsvalue)
@@ -2442,6 +3084,9 @@ STATIC MYBOOL mat_appendvalue(MATrec *mat, int Row, REAL Value)
   /* Update column count */
   (*elmnr)++;
   mat->row_end_valid = FALSE;
+  if(Column <= mat->row_end_cols)
+    mat->row_end_cols = 0;
+  SETMIN(mat->vmap_cols, Column - 1);
 
   return(TRUE);
 }
@@ -2451,7 +3096,7 @@ STATIC MYBOOL mat_equalRows(MATrec *mat, int baserow, int comprow)
   MYBOOL status = FALSE;
 
   if(mat_validate(mat)) {
-    int bj1 = 0, ej1, bj2 = 0, ej2;
+    NZINDEX bj1 = 0, ej1, bj2 = 0, ej2;
 
     /* Get starting and ending positions */
     if(baserow >= 0)
@@ -2480,7 +3125,7 @@ STATIC MYBOOL mat_equalRows(MATrec *mat, int baserow, int comprow)
   return( status );
 }
 
-STATIC int mat_findcolumn(MATrec *mat, int matindex)
+STATIC int mat_findcolumn(MATrec *mat, NZINDEX matindex)
 {
   int j;
 
@@ -2494,7 +3139,8 @@ STATIC int mat_findcolumn(MATrec *mat, int matindex)
 STATIC int mat_expandcolumn(MATrec *mat, int colnr, REAL *column, int *nzlist, MYBOOL signedA)
 {
   MYBOOL  isA = (MYBOOL) (mat->lp->matA == mat);
-  int     i, ie, j, nzcount = 0;
+  int     j, unit, nzcount = 0;
+  NZINDEX i, ie;
   REAL    *matValue;
   int     *matRownr;
 
@@ -2512,10 +3158,11 @@ STATIC int mat_expandcolumn(MATrec *mat, int colnr, REAL *column, int *nzlist, M
   ie = mat->col_end[colnr];
   matRownr = &COL_MAT_ROWNR(i);
   matValue = &COL_MAT_VALUE(i);
+  unit = (colnr <= mat->vmap_cols ? mat->vmap_unit[colnr] : 0);
   for(; i < ie;
       i++, matRownr += matRowColStep, matValue += matValueStep) {
     j = *matRownr;
-    column[j] = *matValue;
+    column[j] = (unit != 0 ? unit : *matValue);
     if(signedA && is_chsign(mat->lp, j))
       column[j] = -column[j];
     nzcount++;
@@ -2529,10 +3176,10 @@ STATIC int mat_expandcolumn(MATrec *mat, int colnr, REAL *column, int *nzlist, M
 
 STATIC MYBOOL mat_computemax(MATrec *mat)
 {
-  int  *rownr = &COL_MAT_ROWNR(0),
-       *colnr = &COL_MAT_COLNR(0),
-       i = 0, ie = mat->col_end[mat->columns], ez = 0;
-  REAL *value = &COL_MAT_VALUE(0), epsmachine = mat->lp->epsmachine, absvalue;
+  int     *rownr = &COL_MAT_ROWNR(0),
+          *colnr = &COL_MAT_COLNR(0);
+  NZINDEX i = 0, ie = mat->col_end[mat->columns], ez = 0;
+  REAL    *value = &COL_MAT_VALUE(0), epsmachine = mat->lp->epsmachine, absvalue;
 
   /* Prepare arrays */
   if(!allocREAL(mat->lp, &mat->colmax, mat->columns_alloc+1, AUTOMATIC) ||
@@ -2558,13 +3205,13 @@ STATIC MYBOOL mat_computemax(MATrec *mat)
     SETMAX(mat->rowmax[0], mat->rowmax[i]);
   mat->infnorm = mat->colmax[0] = mat->rowmax[0];
   if(mat->dynrange == 0) {
-    report(mat->lp, SEVERE, "%d matrix contains zero-valued coefficients.\n", ez);
+    report(mat->lp, SEVERE, "%.0f matrix contains zero-valued coefficients.\n", (double) ez);
     mat->dynrange = mat->lp->infinite;
   }
   else {
     mat->dynrange = mat->infnorm / mat->dynrange;
     if(ez > 0)
-      report(mat->lp, IMPORTANT, "%d matrix coefficients below machine precision were found.\n", ez);
+      report(mat->lp, IMPORTANT, "%.0f matrix coefficients below machine precision were found.\n", (double) ez);
   }
 
   return( TRUE );
@@ -2572,7 +3219,7 @@ STATIC MYBOOL mat_computemax(MATrec *mat)
 
 STATIC MYBOOL mat_transpose(MATrec *mat)
 {
-  int     i, j, nz, k;
+  NZINDEX i, j, nz, k;
   MYBOOL  status;
 
   status = mat_validate(mat);
@@ -2585,11 +3232,17 @@ STATIC MYBOOL mat_transpose(MATrec *mat)
       MATitem *newmat;
       newmat = (MATitem *) malloc((mat->mat_alloc) * sizeof(*(mat->col_mat)));
       j = mat->row_end[0];
+#ifdef _OPENMP
+#pragma omp parallel for private(k) if(nz >= MAT_PARALLELNZ)
+#endif
       for(i = nz-1; i >= j ; i--) {
         k = i-j;
         newmat[k] = mat->col_mat[mat->row_mat[i]];
         newmat[k].row_nr = newmat[k].col_nr;
       }
+#ifdef _OPENMP
+#pragma omp parallel for private(k) if(nz >= MAT_PARALLELNZ)
+#endif
       for(i = j-1; i >= 0 ; i--) {
         k = nz-j+i;
         newmat[k] = mat->col_mat[mat->row_mat[i]];
@@ -2604,11 +3257,17 @@ STATIC MYBOOL mat_transpose(MATrec *mat)
       allocINT(mat->lp, &newRownr, mat->mat_alloc, FALSE);
 
       j = mat->row_end[0];
+#ifdef _OPENMP
+#pragma omp parallel for private(k) if(nz >= MAT_PARALLELNZ)
+#endif
       for(i = nz-1; i >= j ; i--) {
         k = i-j;
         newValue[k] = ROW_MAT_VALUE(i);
         newRownr[k] = ROW_MAT_COLNR(i);
       }
+#ifdef _OPENMP
+#pragma omp parallel for private(k) if(nz >= MAT_PARALLELNZ)
+#endif
       for(i = j-1; i >= 0 ; i--) {
         k = nz-j+i;
         newValue[k] = ROW_MAT_VALUE(i);
@@ -2641,6 +3300,8 @@ STATIC MYBOOL mat_transpose(MATrec *mat)
     /* Finally set current storage mode */
     mat->is_roworder = (MYBOOL) !mat->is_roworder;
     mat->row_end_valid = FALSE;
+    mat->row_end_cols = 0;
+    mat->vmap_cols = 0;
   }
   return(status);
 }
@@ -2694,20 +3355,19 @@ STATIC int restoreUndoLadder(DeltaVrec *DV, REAL target[])
 
   if(DV->activelevel > 0) {
     MATrec *mat = DV->tracker;
-    int    iB = mat->col_end[DV->activelevel-1],
-           iE = mat->col_end[DV->activelevel],
-           *matRownr = &COL_MAT_ROWNR(iB);
-    REAL   *matValue = &COL_MAT_VALUE(iB),
-           oldvalue;
-
-    /* Restore the values */
-    iD = iE-iB;
-    for(; iB < iE; iB++, matValue += matValueStep, matRownr += matRowColStep) {
-      oldvalue = *matValue;
+    NZINDEX iB = mat->col_end[DV->activelevel-1],
+            iE = mat->col_end[DV->activelevel];
+    REAL    oldvalue;
+
+    /* Restore the values in reverse order, so that the original value
+       prevails when an item was modified more than once at this level */
+    iD = (int) (iE-iB);
+    for(iE--; iE >= iB; iE--) {
+      oldvalue = COL_MAT_VALUE(iE);
 #ifdef UseMilpSlacksRCF  /* Check if we should include ranged constraints */
-      target[(*matRownr)] = oldvalue;
+      target[COL_MAT_ROWNR(iE)] = oldvalue;
 #else
-      target[DV->lp->rows+(*matRownr)] = oldvalue;
+      target[DV->lp->rows+COL_MAT_ROWNR(iE)] = oldvalue;
 #endif
     }
 
@@ -2763,9 +3423,10 @@ STATIC MYBOOL appendUndoPresolve(lprec *lp, MYBOOL isprimal, REAL beta, int coln
 
     /* Handle case where a slack variable is referenced */
     else {
-      int ipos, jx = mat->col_tag[ix];
+      int     jx = mat->col_tag[ix];
+      NZINDEX ipos;
       mat_setvalue(mat, jx, ix, beta, FALSE);
-      jx = mat_findins(mat, jx, ix, &ipos, FALSE);
+      mat_findins(mat, jx, ix, &ipos, FALSE);
       COL_MAT_ROWNR(ipos) = colnrDep;
     }
     return( TRUE );
@@ -3049,104 +3710,161 @@ Cleanup:
 } /* invert */
 
 
-STATIC MYBOOL fimprove(lprec *lp, REAL *pcol, int *nzidx, REAL roundzero)
+/* Compute the residual of a basis solve with compensated (Neumaier) summation, i.e.
+   r = b - B x for FTRAN and r = c - B'y for BTRAN; the basis columns are retrieved
+   in the same way as the BFP obtains them for factorization, so that the vector
+   indexing matches the one used by bfp_ftran_normal and bfp_btran_normal. */
+STATIC REAL resid_solve(lprec *lp, REAL *sol, REAL *rhs, REAL *resid, REAL *comp,
+                                   int *rownr, REAL *value, MYBOOL transpose)
 {
-  REAL   *errors, sdp;
-  int    j;
-  MYBOOL Ok = TRUE;
-
-  allocREAL(lp, &errors, lp->rows + 1, FALSE);
-  if(errors == NULL) {
-    Ok = FALSE;
-    return(Ok);
+  int  i, j, k, nz, offset = lp->bfp_rowoffset(lp),
+       base = lp->bfp_indexbase(lp);
+  REAL s, c, t, v, rmax = 0;
+
+  if(base > 0)
+    base += offset - 1;
+
+  /* BTRAN: one compensated dot product per basis column */
+  if(transpose) {
+    for(j = 1; j <= lp->rows + offset; j++) {
+      s = rhs[j - offset];
+      c = 0;
+      nz = lp->get_basiscolumn(lp, j, rownr, value);
+      for(k = 1; k <= nz; k++) {
+        v = -value[k] * sol[rownr[k] - base];
+        t = s + v;
+        if(fabs(s) >= fabs(v))
+          c += (s - t) + v;
+        else
+          c += (v - t) + s;
+        s = t;
+      }
+      resid[j - offset] = s + c;
+    }
   }
-  MEMCOPY(errors, pcol, lp->rows + 1);
-  lp->bfp_ftran_normal(lp, pcol, nzidx);
-  prod_Ax(lp, NULL, pcol, NULL, 0.0, -1,
-                                errors, NULL, MAT_ROUNDDEFAULT);
-  lp->bfp_ftran_normal(lp, errors, NULL);
 
-  sdp = 0;
-  for(j = 1; j <= lp->rows; j++)
-    if(fabs(errors[j])>sdp)
-      sdp = fabs(errors[j]);
-  if(sdp > lp->epsmachine) {
-    report(lp, DETAILED, "Iterative FTRAN correction metric %g", sdp);
-    for(j = 1; j <= lp->rows; j++) {
-      pcol[j] += errors[j];
-      my_roundzero(pcol[j], roundzero);
+  /* FTRAN: scatter each basis column with a running compensation per row */
+  else {
+    MEMCOPY(resid, rhs, lp->rows + 1);
+    MEMCLEAR(comp, lp->rows + 1);
+    for(j = 1; j <= lp->rows + offset; j++) {
+      if(sol[j - offset] == 0)
+        continue;
+      nz = lp->get_basiscolumn(lp, j, rownr, value);
+      for(k = 1; k <= nz; k++) {
+        i = rownr[k] - base;
+        s = resid[i];
+        v = -value[k] * sol[j - offset];
+        t = s + v;
+        if(fabs(s) >= fabs(v))
+          comp[i] += (s - t) + v;
+        else
+          comp[i] += (v - t) + s;
+        resid[i] = t;
+      }
     }
+    for(i = 0; i <= lp->rows; i++)
+      resid[i] += comp[i];
   }
-  FREE(errors);
-  return(Ok);
+
+  /* The objective row is not part of the system unless it is in the basis */
+  if(offset == 0)
+    resid[0] = 0;
+  for(i = 0; i <= lp->rows; i++)
+    SETMAX(rmax, fabs(resid[i]));
+
+  return( rmax );
 }
 
-STATIC MYBOOL bimprove(lprec *lp, REAL *rhsvector, int *nzidx, REAL roundzero)
+/* Iterative refinement of a basis solve; the residual is accumulated in working
+   precision with compensated summation rather than in the (slow) REALXP type, and
+   refinement stops once it is within an epspivot-based tolerance.  The work vectors
+   are taken from the work array pool, since this runs on every ftran and btran */
+STATIC MYBOOL refine_solve(lprec *lp, REAL *vector, int *nzidx, REAL roundzero, MYBOOL transpose)
 {
-  int    j;
-  REAL   *errors, err, maxerr;
-  MYBOOL Ok = TRUE;
-
-  allocREAL(lp, &errors, lp->sum + 1, FALSE);
-  if(errors == NULL) {
-    Ok = FALSE;
-    return(Ok);
+  int    i, step, *rownr;
+  REAL   *rhs, *resid, *comp, *value, rmax, tol;
+  MYBOOL Ok;
+
+  rhs   = (REAL *) mempool_obtainVector(lp->workarrays, lp->rows + 1, sizeof(*rhs));
+  resid = (REAL *) mempool_obtainVector(lp->workarrays, lp->rows + 1, sizeof(*resid));
+  comp  = (REAL *) mempool_obtainVector(lp->workarrays, lp->rows + 1, sizeof(*comp));
+  value = (REAL *) mempool_obtainVector(lp->workarrays, lp->rows + 2, sizeof(*value));
+  rownr = (int *) mempool_obtainVector(lp->workarrays, lp->rows + 2, sizeof(*rownr));
+  Ok = (MYBOOL) ((rhs != NULL) && (resid != NULL) && (comp != NULL) &&
+                 (value != NULL) && (rownr != NULL));
+  if(!Ok) {
+    if(transpose)
+      lp->bfp_btran_normal(lp, vector, nzidx);
+    else
+      lp->bfp_ftran_normal(lp, vector, nzidx);
+    goto Finish;
   }
-  MEMCOPY(errors, rhsvector, lp->sum + 1);
-
-  /* Solve Ax=b for x, compute b back */
-  lp->bfp_btran_normal(lp, errors, nzidx);
-  prod_xA(lp, NULL, errors, NULL, 0.0, 1.0,
-                                  errors, NULL,
-                                  MAT_ROUNDDEFAULT);
 
-  /* Take difference with ingoing values, while shifting the column values
-     to the rows section and zeroing the columns again */
-  for(j = 1; j <= lp->rows; j++)
-    errors[j] = errors[lp->rows+lp->var_basic[j]] - rhsvector[j];
-  for(j = lp->rows; j <= lp->sum; j++)
-    errors[j] = 0;
+  /* Do the regular solve, keeping the right-hand side */
+  MEMCOPY(rhs, vector, lp->rows + 1);
+  if(transpose)
+    lp->bfp_btran_normal(lp, vector, nzidx);
+  else
+    lp->bfp_ftran_normal(lp, vector, nzidx);
 
-  /* Solve the b errors for the iterative x adjustment */
-  lp->bfp_btran_normal(lp, errors, NULL);
+  tol = 0;
+  for(i = 0; i <= lp->rows; i++)
+    SETMAX(tol, fabs(rhs[i]));
+  tol = DEF_REFINEREL * lp->epspivot * (1 + tol);
 
-  /* Generate the adjustments and compute statistic */
-  maxerr = 0;
-  for(j = 1; j <= lp->rows; j++) {
-    if(lp->var_basic[j]<=lp->rows) continue;
-    err = errors[lp->rows+lp->var_basic[j]];
-    if(fabs(err)>maxerr)
-      maxerr = fabs(err);
+  /* Correct the solution with the solved residual until it is small enough */
+  for(step = 0; step < DEF_REFINEMAX; step++) {
+    rmax = resid_solve(lp, vector, rhs, resid, comp, rownr, value, transpose);
+    if(rmax <= tol)
+      break;
+    if(transpose)
+      lp->bfp_btran_normal(lp, resid, NULL);
+    else
+      lp->bfp_ftran_normal(lp, resid, NULL);
+    for(i = 1 - lp->bfp_rowoffset(lp); i <= lp->rows; i++)
+      vector[i] += resid[i];
+    lp->refine_count++;
   }
-  if(maxerr > lp->epsmachine) {
-    report(lp, DETAILED, "Iterative BTRAN correction metric %g", maxerr);
-    for(j = 1; j <= lp->rows; j++) {
-      if(lp->var_basic[j]<=lp->rows) continue;
-      rhsvector[j] += errors[lp->rows+lp->var_basic[j]];
-      my_roundzero(rhsvector[j], roundzero);
-    }
+  if(step > 0) {
+    report(lp, DETAILED, "Iterative %s correction metric %g after %d steps\n",
+                         (transpose ? "BTRAN" : "FTRAN"), rmax, step);
+    for(i = 0; i <= lp->rows; i++)
+      my_roundzero(vector[i], roundzero);
   }
-  FREE(errors);
-  return(Ok);
+
+Finish:
+  mempool_releaseVector(lp->workarrays, (char *) rhs, FALSE);
+  mempool_releaseVector(lp->workarrays, (char *) resid, FALSE);
+  mempool_releaseVector(lp->workarrays, (char *) comp, FALSE);
+  mempool_releaseVector(lp->workarrays, (char *) value, FALSE);
+  mempool_releaseVector(lp->workarrays, (char *) rownr, FALSE);
+  return( Ok );
+}
+
+STATIC MYBOOL fimprove(lprec *lp, REAL *pcol, int *nzidx, REAL roundzero)
+{
+  return( refine_solve(lp, pcol, nzidx, roundzero, FALSE) );
+}
+
+STATIC MYBOOL bimprove(lprec *lp, REAL *rhsvector, int *nzidx, REAL roundzero)
+{
+  return( refine_solve(lp, rhsvector, nzidx, roundzero, TRUE) );
 }
 
 STATIC void ftran(lprec *lp, REAL *rhsvector, int *nzidx, REAL roundzero)
 {
-#if 0
-  if(is_action(lp->improve, IMPROVE_SOLUTION) && lp->bfp_pivotcount(lp))
+  if(is_action(lp->improve, IMPROVE_REFINE))
     fimprove(lp, rhsvector, nzidx, roundzero);
   else
-#endif
     lp->bfp_ftran_normal(lp, rhsvector, nzidx);
 }
 
 STATIC void btran(lprec *lp, REAL *rhsvector, int *nzidx, REAL roundzero)
 {
-#if 0
-  if(is_action(lp->improve, IMPROVE_SOLUTION) && lp->bfp_pivotcount(lp))
+  if(is_action(lp->improve, IMPROVE_REFINE))
     bimprove(lp, rhsvector, nzidx, roundzero);
   else
-#endif
     lp->bfp_btran_normal(lp, rhsvector, nzidx);
 }
 
@@ -3320,9 +4038,10 @@ STATIC MYBOOL get_colIndexA(lprec *lp, int varset, int *colindex, MYBOOL append)
 STATIC int prod_Ax(lprec *lp, int *coltarget, REAL *input, int *nzinput,
                               REAL roundzero, REAL ofscalar,
                               REAL *output, int *nzoutput, int roundmode)
-/* prod_Ax is only used in fimprove; note that it is NOT VALIDATED/verified as of 20030801 - KE */
+/* prod_Ax was only used in fimprove; note that it is NOT VALIDATED/verified as of 20030801 - KE */
 {
-  int      j, colnr, ib, ie, vb, ve;
+  int      j, colnr, vb, ve;
+  NZINDEX  ib, ie;
   MYBOOL   localset, localnz = FALSE, isRC;
   MATrec   *mat = lp->matA;
   REAL     sdp;
@@ -3366,10 +4085,28 @@ STATIC int prod_Ax(lprec *lp, int *coltarget, REAL *input, int *nzinput,
       ib = mat->col_end[colnr - 1];
       ie = mat->col_end[colnr];
       rownr = &COL_MAT_ROWNR(ib);
-      value = &COL_MAT_VALUE(ib);
-      for(; ib < ie;
-          ib++, rownr += matRowColStep, value += matValueStep) {
-        output[*rownr] += (*value)*sdp;
+      if((colnr <= mat->vmap_cols) && (mat->vmap_unit[colnr] != 0)) {
+        if(mat->vmap_unit[colnr] < 0)
+          sdp = -sdp;
+        for(; ib < ie; ib++, rownr += matRowColStep)
+          output[*rownr] += sdp;
+      }
+      else if((colnr <= mat->vmap_cols) && (mat->vmap_index8 != NULL)) {
+        unsigned char *index = mat->vmap_index8 + ib;
+        for(; ib < ie; ib++, rownr += matRowColStep, index++)
+          output[*rownr] += mat->vmap_value[*index]*sdp;
+      }
+      else if(colnr <= mat->vmap_cols) {
+        unsigned short *index = mat->vmap_index16 + ib;
+        for(; ib < ie; ib++, rownr += matRowColStep, index++)
+          output[*rownr] += mat->vmap_value[*index]*sdp;
+      }
+      else {
+        value = &COL_MAT_VALUE(ib);
+        for(; ib < ie;
+            ib++, rownr += matRowColStep, value += matValueStep) {
+          output[*rownr] += (*value)*sdp;
+        }
       }
     }
   }
@@ -3391,10 +4128,14 @@ STATIC int prod_xA(lprec *lp, int *coltarget,
    This means that if the basis only contains non-slack variables, output may point to
    the same vector as input, without overwriting the [0..rows] elements. */
 {
-  int      colnr, rownr, varnr, ib, ie, vb, ve, nrows = lp->rows;
+  int      colnr, rownr, varnr, vb, ve, nrows = lp->rows;
+  NZINDEX  ib, ie;
   MYBOOL   localset, localnz = FALSE, includeOF, isRC;
   REALXP   vmax;
   register REALXP v;
+#ifdef REALXP_COMPENSATED
+  REAL     vc;
+#endif
   int      inz, *rowin, countNZ = 0;
   MATrec   *mat = lp->matA;
   register REAL     *matValue;
@@ -3442,11 +4183,11 @@ STATIC int prod_xA(lprec *lp, int *coltarget,
     varnr = coltarget[vb];
 
     if(varnr <= nrows) {
-      v = input[varnr];
+      my_xpinit(v, vc, input[varnr]);
     }
     else {
       colnr = varnr - nrows;
-      v = 0;
+      my_xpinit(v, vc, 0);
       ib = mat->col_end[colnr - 1];
       ie = mat->col_end[colnr];
       if(ib < ie) {
@@ -3460,48 +4201,72 @@ STATIC int prod_xA(lprec *lp, int *coltarget,
           /* Do the OF */
           if(includeOF)
 #ifdef DirectArrayOF
-            v += input[0] * lp->obj[colnr] * ofscalar;
+            my_xpaddprod(v, vc, input[0], lp->obj[colnr] * ofscalar);
 #else
-            v += input[0] * get_OF_active(lp, varnr, ofscalar);
+            my_xpaddprod(v, vc, input[0], get_OF_active(lp, varnr, ofscalar));
 #endif
 
           /* Initialize pointers */
           matRownr = &COL_MAT_ROWNR(ib);
           matValue = &COL_MAT_VALUE(ib);
 
-          /* Do extra loop optimization based on target window overlaps */
+          /* Use the value map if it covers the column; the products with +/-1
+             reduce to sums and the other values are read by their table index */
+          if(colnr <= mat->vmap_cols) {
+            if(mat->vmap_unit[colnr] > 0) {
+              for(; ib < ie; ib++, matRownr += matRowColStep)
+                my_xpaddprod(v, vc, input[*matRownr], 1.0);
+            }
+            else if(mat->vmap_unit[colnr] < 0) {
+              for(; ib < ie; ib++, matRownr += matRowColStep)
+                my_xpaddprod(v, vc, input[*matRownr], -1.0);
+            }
+            else if(mat->vmap_index8 != NULL) {
+              unsigned char *matIndex = mat->vmap_index8 + ib;
+              for(; ib < ie; ib++, matRownr += matRowColStep, matIndex++)
+                my_xpaddprod(v, vc, input[*matRownr], mat->vmap_value[*matIndex]);
+            }
+            else {
+              unsigned short *matIndex = mat->vmap_index16 + ib;
+              for(; ib < ie; ib++, matRownr += matRowColStep, matIndex++)
+                my_xpaddprod(v, vc, input[*matRownr], mat->vmap_value[*matIndex]);
+            }
+          }
+          else {
+            /* Do extra loop optimization based on target window overlaps */
 #ifdef UseLocalNZ
-          if((ib < ie)
-             && (colnr <= *nzinput)
-             && (COL_MAT_ROWNR(ie-1) >= nzinput[colnr])
-             && (*matRownr <= nzinput[*nzinput])
-             )
+            if((ib < ie)
+               && (colnr <= *nzinput)
+               && (COL_MAT_ROWNR(ie-1) >= nzinput[colnr])
+               && (*matRownr <= nzinput[*nzinput])
+               )
 #endif
 #ifdef NoLoopUnroll
-          /* Then loop over all regular rows */
-          for(; ib < ie; ib++) {
-            v += input[*matRownr] * (*matValue);
-            matValue += matValueStep;
-            matRownr += matRowColStep;
-          }
+            /* Then loop over all regular rows */
+            for(; ib < ie; ib++) {
+              my_xpaddprod(v, vc, input[*matRownr], *matValue);
+              matValue += matValueStep;
+              matRownr += matRowColStep;
+            }
 #else
-          /* Prepare for simple loop unrolling */
-          if(((ie-ib) % 2) == 1) {
-            v += input[*matRownr] * (*matValue);
-            ib++;
-            matValue += matValueStep;
-            matRownr += matRowColStep;
-          }
+            /* Prepare for simple loop unrolling */
+            if(((ie-ib) % 2) == 1) {
+              my_xpaddprod(v, vc, input[*matRownr], *matValue);
+              ib++;
+              matValue += matValueStep;
+              matRownr += matRowColStep;
+            }
 
-          /* Then loop over remaining pairs of regular rows */
-          while(ib < ie) {
-            v += input[*matRownr] * (*matValue);
-            v += input[*(matRownr+matRowColStep)] * (*(matValue+matValueStep));
-            ib += 2;
-            matValue += 2*matValueStep;
-            matRownr += 2*matRowColStep;
-          }
+            /* Then loop over remaining pairs of regular rows */
+            while(ib < ie) {
+              my_xpaddprod(v, vc, input[*matRownr], *matValue);
+              my_xpaddprod(v, vc, input[*(matRownr+matRowColStep)], *(matValue+matValueStep));
+              ib += 2;
+              matValue += 2*matValueStep;
+              matRownr += 2*matRowColStep;
+            }
 #endif
+          }
         }
         /* Do sparse input vector version */
         else {
@@ -3509,9 +4274,9 @@ STATIC int prod_xA(lprec *lp, int *coltarget,
           /* Do the OF */
           if(includeOF)
 #ifdef DirectArrayOF
-            v += input[0] * lp->obj[colnr] * ofscalar;
+            my_xpaddprod(v, vc, input[0], lp->obj[colnr] * ofscalar);
 #else
-            v += input[0] * get_OF_active(lp, varnr, ofscalar);
+            my_xpaddprod(v, vc, input[0], get_OF_active(lp, varnr, ofscalar));
 #endif
 
           /* Initialize pointers */
@@ -3537,7 +4302,7 @@ STATIC int prod_xA(lprec *lp, int *coltarget,
             }
             /* Perform dot product operation if there was a match */
             if(*rowin == *matRownr) {
-              v += input[*rowin] * (*matValue);
+              my_xpaddprod(v, vc, input[*rowin], *matValue);
               /* Step forward at left */
               inz++;
               rowin++;
@@ -3545,6 +4310,7 @@ STATIC int prod_xA(lprec *lp, int *coltarget,
           }
         }
       }
+      my_xpfinish(v, vc);
       if((roundmode & MAT_ROUNDABS) != 0) {
         my_roundzero(v, roundzero);
       }
@@ -3583,7 +4349,7 @@ STATIC int prod_xA(lprec *lp, int *coltarget,
           nzoutput[ie] = rownr;
         }
       }
-      countNZ = ie;
+      countNZ = (int) ie;
     }
   }
 
@@ -3603,10 +4369,14 @@ STATIC MYBOOL prod_xA2(lprec *lp, int *coltarget,
                                   REAL *drow, REAL droundzero, int *nzdrow,
                                   REAL ofscalar, int roundmode)
 {
-  int      varnr, colnr, ib, ie, vb, ve, nrows = lp->rows;
+  int      varnr, colnr, vb, ve, nrows = lp->rows;
+  NZINDEX  ib, ie;
   MYBOOL   includeOF, isRC;
   REALXP   dmax, pmax;
   register REALXP d, p;
+#ifdef REALXP_COMPENSATED
+  REAL     dc, pc;
+#endif
   MATrec   *mat = lp->matA;
   REAL     value;
   register REAL     *matValue;
@@ -3645,15 +4415,15 @@ STATIC MYBOOL prod_xA2(lprec *lp, int *coltarget,
     varnr = coltarget[vb];
 
     if(varnr <= nrows) {
-      p = prow[varnr];
-      d = drow[varnr];
+      my_xpinit(p, pc, prow[varnr]);
+      my_xpinit(d, dc, drow[varnr]);
     }
     else {
 
       colnr = varnr - nrows;
 
-      p = 0;
-      d = 0;
+      my_xpinit(p, pc, 0);
+      my_xpinit(d, dc, 0);
       ib = mat->col_end[colnr - 1];
       ie = mat->col_end[colnr];
 
@@ -3666,8 +4436,8 @@ STATIC MYBOOL prod_xA2(lprec *lp, int *coltarget,
 #else
           value = get_OF_active(lp, varnr, ofscalar);
 #endif
-          p += prow[0] * value;
-          d += drow[0] * value;
+          my_xpaddprod(p, pc, prow[0], value);
+          my_xpaddprod(d, dc, drow[0], value);
         }
 
         /* Then loop over all regular rows */
@@ -3675,16 +4445,16 @@ STATIC MYBOOL prod_xA2(lprec *lp, int *coltarget,
         matValue = &COL_MAT_VALUE(ib);
 #ifdef NoLoopUnroll
         for( ; ib < ie; ib++) {
-          p += prow[*matRownr] * (*matValue);
-          d += drow[*matRownr] * (*matValue);
+          my_xpaddprod(p, pc, prow[*matRownr], *matValue);
+          my_xpaddprod(d, dc, drow[*matRownr], *matValue);
           matValue += matValueStep;
           matRownr += matRowColStep;
         }
 #else
         /* Prepare for simple loop unrolling */
         if(((ie-ib) % 2) == 1) {
-          p += prow[*matRownr] * (*matValue);
-          d += drow[*matRownr] * (*matValue);
+          my_xpaddprod(p, pc, prow[*matRownr], *matValue);
+          my_xpaddprod(d, dc, drow[*matRownr], *matValue);
           ib++;
           matValue += matValueStep;
           matRownr += matRowColStep;
@@ -3692,10 +4462,10 @@ STATIC MYBOOL prod_xA2(lprec *lp, int *coltarget,
 
         /* Then loop over remaining pairs of regular rows */
         while(ib < ie) {
-          p += prow[*matRownr] * (*matValue);
-          p += prow[*(matRownr+matRowColStep)] * (*(matValue+matValueStep));
-          d += drow[*matRownr] * (*matValue);
-          d += drow[*(matRownr+matRowColStep)] * (*(matValue+matValueStep));
+          my_xpaddprod(p, pc, prow[*matRownr], *matValue);
+          my_xpaddprod(p, pc, prow[*(matRownr+matRowColStep)], *(matValue+matValueStep));
+          my_xpaddprod(d, dc, drow[*matRownr], *matValue);
+          my_xpaddprod(d, dc, drow[*(matRownr+matRowColStep)], *(matValue+matValueStep));
           ib += 2;
           matValue += 2*matValueStep;
           matRownr += 2*matRowColStep;
@@ -3703,6 +4473,8 @@ STATIC MYBOOL prod_xA2(lprec *lp, int *coltarget,
 #endif
 
       }
+      my_xpfinish(p, pc);
+      my_xpfinish(d, dc);
       if((roundmode & MAT_ROUNDABS) != 0) {
         my_roundzero(p, proundzero);
         my_roundzero(d, droundzero);
@@ -3745,7 +4517,7 @@ STATIC MYBOOL prod_xA2(lprec *lp, int *coltarget,
           nzprow[ie] = varnr;
         }
       }
-      *nzprow = ie;
+      *nzprow = (int) ie;
     }
     if((droundzero > 0) && (nzdrow != NULL)) {
       ie = 0;
@@ -3762,7 +4534,7 @@ STATIC MYBOOL prod_xA2(lprec *lp, int *coltarget,
           nzdrow[ie] = varnr;
         }
       }
-      *nzdrow = ie;
+      *nzdrow = (int) ie;
     }
   }
 
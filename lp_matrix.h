@@ -31,6 +31,20 @@ typedef struct _MATitem
 #define NoLoopUnroll              /* Do not do loop unrolling */
 #define DirectArrayOF             /* Reference lp->obj[] array instead of function call */
 
+/* Minimum number of non-zeros before the row index is built in parallel column
+   blocks; only effective when compiled with OpenMP support */
+#define MAT_PARALLELNZ       250000
+
+/* Maximum number of distinct values for which the value map of MEMORY_VALUEMAP
+   is built; up to 256 values use a single byte index per element */
+#define MAT_VMAPMAXSIZE       65536
+
+/* Minimum column length for element lookups through the coordinate hash of
+   MEMORY_HASHINDEX, and the number of lookups after a structural edit of the
+   matrix before the hash is rebuilt */
+#define MAT_HASHMINLEN           32
+#define MAT_HASHREBUILD          16
+
 
 /* Matrix column access macros to be able to easily change storage model */
 #define CAM_Record                0
@@ -113,7 +127,7 @@ typedef struct _MATrec
   /* Allocated memory */
   int       rows_alloc;
   int       columns_alloc;
-  int       mat_alloc;          /* The allocated size for matrix sized structures */
+  NZINDEX   mat_alloc;          /* The allocated size for matrix sized structures */
 
   /* Sparse problem matrix storage */
 #if MatrixColAccess==CAM_Record  
@@ -123,13 +137,13 @@ typedef struct _MATrec
   int       *col_mat_rownr;
   REAL      *col_mat_value;
 #endif  
-  int       *col_end;           /* columns_alloc+1 : col_end[i] is the index of the
+  NZINDEX   *col_end;           /* columns_alloc+1 : col_end[i] is the index of the
                                    first element after column i; column[i] is stored
                                    in elements col_end[i-1] to col_end[i]-1 */
   int       *col_tag;           /* user-definable tag associated with each column */
 
 #if MatrixRowAccess==RAM_Index
-  int       *row_mat;           /* mat_alloc : From index 0, row_mat contains the
+  NZINDEX   *row_mat;           /* mat_alloc : From index 0, row_mat contains the
                                    row-ordered index of the elements of col_mat */
 #elif MatrixColAccess==CAM_Record
   MATitem   *row_mat;           /* mat_alloc : From index 0, row_mat contains the
@@ -139,7 +153,7 @@ typedef struct _MATrec
   int       *row_mat_rownr;
   REAL      *row_mat_value;
 #endif
-  int       *row_end;           /* rows_alloc+1 : row_end[i] is the index of the
+  NZINDEX   *row_end;           /* rows_alloc+1 : row_end[i] is the index of the
                                    first element in row_mat after row i */
   int       *row_tag;           /* user-definable tag associated with each row */
 
@@ -149,6 +163,21 @@ typedef struct _MATrec
   REAL      epsvalue;           /* Zero element rejection threshold */
   REAL      infnorm;            /* The largest absolute value in the matrix */
   REAL      dynrange;
+  int       row_end_cols;       /* Leading columns still indexed by row_end & row_mat when
+                                   only later columns were appended or edited since the
+                                   last rebuild; the rest is rebuilt by mat_validate */
+  NZINDEX   row_end_nz;         /* Non-zero count of these leading columns */
+  REAL      *vmap_value;        /* Table of the distinct element values in the value map */
+  unsigned char  *vmap_index8;  /* Index into vmap_value of each element, or NULL if ... */
+  unsigned short *vmap_index16; /* ... more than 256 distinct values require this one */
+  signed char *vmap_unit;       /* +1/-1 for columns with only +1/-1 elements, else 0 */
+  int       vmap_cols;          /* Leading columns covered by the value map; 0 if none */
+  int       vmap_size;          /* Number of values in vmap_value */
+  NZINDEX   *elm_hash;          /* Coordinate hash of the element positions+1 in long
+                                   columns, or NULL; hits are verified against col_mat */
+  NZINDEX   elm_hashmask;       /* Hash table size - 1 */
+  NZINDEX   elm_hashnz;         /* Non-zero count when the hash was built */
+  int       elm_hashstale;      /* Lookups since the non-zero count last differed */
   MYBOOL    row_end_valid;      /* TRUE if row_end & row_mat are valid */
   MYBOOL    is_roworder;        /* TRUE if the current (temporary) matrix order is row-wise */
 
@@ -168,34 +197,44 @@ __EXTERN_C {
 
 /* Sparse matrix routines */
 STATIC MATrec *mat_create(lprec *lp, int rows, int columns, REAL epsvalue);
-STATIC MYBOOL mat_memopt(MATrec *mat, int rowextra, int colextra, int nzextra);
+STATIC MYBOOL mat_memopt(MATrec *mat, int rowextra, int colextra, NZINDEX nzextra);
 STATIC void mat_free(MATrec **matrix);
 STATIC MYBOOL inc_matrow_space(MATrec *mat, int deltarows);
 STATIC int mat_mapreplace(MATrec *mat, LLrec *rowmap, LLrec *colmap, MATrec *insmat);
 STATIC int mat_matinsert(MATrec *mat, MATrec *insmat);
 STATIC int mat_zerocompact(MATrec *mat);
 STATIC int mat_rowcompact(MATrec *mat, MYBOOL dozeros);
-STATIC int mat_colcompact(MATrec *mat, int prev_rows, int prev_cols);
+STATIC int mat_colcompact(MATrec *mat, int prev_rows, int prev_cols, LLrec *colmap);
 STATIC MYBOOL inc_matcol_space(MATrec *mat, int deltacols);
-STATIC MYBOOL inc_mat_space(MATrec *mat, int mindelta);
+STATIC MYBOOL inc_mat_space(MATrec *mat, NZINDEX mindelta);
 STATIC int mat_shiftrows(MATrec *mat, int *bbase, int delta, LLrec *varmap);
 STATIC int mat_shiftcols(MATrec *mat, int *bbase, int delta, LLrec *varmap);
 STATIC MATrec *mat_extractmat(MATrec *mat, LLrec *rowmap, LLrec *colmap, MYBOOL negated);
 STATIC int mat_appendrow(MATrec *mat, int count, REAL *row, int *colno, REAL mult, MYBOOL checkrowmode);
 STATIC int mat_appendcol(MATrec *mat, int count, REAL *column, int *rowno, REAL mult, MYBOOL checkrowmode);
-MYBOOL mat_get_data(lprec *lp, int matindex, MYBOOL isrow, int **rownr, int **colnr, REAL **value);
-MYBOOL mat_set_rowmap(MATrec *mat, int row_mat_index, int rownr, int colnr, int col_mat_index);
-STATIC MYBOOL mat_indexrange(MATrec *mat, int index, MYBOOL isrow, int *startpos, int *endpos);
+STATIC NZINDEX mat_appendcsc(MATrec *mat, int count, NZINDEX *col_start, int *row_idx, REAL *values);
+MYBOOL mat_get_data(lprec *lp, NZINDEX matindex, MYBOOL isrow, int **rownr, int **colnr, REAL **value);
+MYBOOL mat_set_rowmap(MATrec *mat, NZINDEX row_mat_index, int rownr, int colnr, NZINDEX col_mat_index);
+STATIC MYBOOL mat_indexrange(MATrec *mat, int index, MYBOOL isrow, NZINDEX *startpos, NZINDEX *endpos);
+STATIC MYBOOL mat_rowmapbuild(MATrec *mat);
+STATIC MYBOOL mat_rowmapappend(MATrec *mat);
+STATIC void mat_rowmapcut(MATrec *mat, int colnr);
 STATIC MYBOOL mat_validate(MATrec *mat);
+STATIC MYBOOL mat_vmapbuild(MATrec *mat);
+STATIC void mat_vmapfree(MATrec *mat);
+STATIC MYBOOL mat_hashbuild(MATrec *mat);
+STATIC void mat_hashfree(MATrec *mat);
+STATIC NZINDEX mat_hashfind(MATrec *mat, int row, int column, NZINDEX low, NZINDEX high);
 STATIC MYBOOL mat_equalRows(MATrec *mat, int baserow, int comprow);
-STATIC int mat_findelm(MATrec *mat, int row, int column);
-STATIC int mat_findins(MATrec *mat, int row, int column, int *insertpos, MYBOOL validate);
+STATIC NZINDEX mat_findelm(MATrec *mat, int row, int column);
+STATIC NZINDEX mat_findins(MATrec *mat, int row, int column, NZINDEX *insertpos, MYBOOL validate);
 STATIC void mat_multcol(MATrec *mat, int col_nr, REAL mult, MYBOOL DoObj);
 STATIC REAL mat_getitem(MATrec *mat, int row, int column);
 STATIC MYBOOL mat_setitem(MATrec *mat, int row, int column, REAL value);
 STATIC MYBOOL mat_additem(MATrec *mat, int row, int column, REAL delta);
 STATIC MYBOOL mat_setvalue(MATrec *mat, int Row, int Column, REAL Value, MYBOOL doscale);
-STATIC int mat_nonzeros(MATrec *mat);
+STATIC MYBOOL mat_setbatch(MATrec *mat, int count, int *rowno, int *colno, REAL *values);
+STATIC NZINDEX mat_nonzeros(MATrec *mat);
 STATIC int mat_collength(MATrec *mat, int colnr);
 STATIC int mat_rowlength(MATrec *mat, int rownr);
 STATIC void mat_multrow(MATrec *mat, int row_nr, REAL mult);
@@ -22,6 +22,12 @@
     v5.1.0    25 July 2004      Added functions for dynamic cut generation.
     v5.2.0    15 December 2004  Added functions for reduced cost variable fixing
                                 and converted to delta-model of B&B bound storage.
+    v5.2.1    17 October 2026   Added propagation of node bound changes through
+                                incrementally maintained row activity tallies.
+    v5.2.2    17 October 2026   Added learning of conflicts from infeasible nodes.
+    v5.2.3    17 October 2026   Added global reduced cost fixing based on the root LP.
+    v5.2.4    17 October 2026   Global reduced cost fixing is now a separate option,
+                                NODE_RCOSTGLOBAL, which is off by default.
    ----------------------------------------------------------------------------------
 */
 
@@ -274,7 +280,7 @@ STATIC BBrec *pop_BB(BBrec *BB)
     1. A probing routine to see of the best OF can be better than incumbent
     2. A presolve routine to fix other variables and detect infeasibility
 
-   THIS IS INACTIVE CODE, PLACEHOLDERS FOR FUTURE DEVELOPMENT!!! */
+   THE PROBING ROUTINE IS INACTIVE CODE, A PLACEHOLDER FOR FUTURE DEVELOPMENT!!! */
 STATIC REAL probe_BB(BBrec *BB)
 {
   int  i, ii;
@@ -304,9 +310,585 @@ STATIC REAL probe_BB(BBrec *BB)
   return( sum );
 }
 
-STATIC REAL presolve_BB(BBrec *BB)
+/* Node bound propagation; the minimum and maximum activity of every row is
+   kept as a finite part plus a count of infinite contributions, and is
+   updated incrementally from the bound changes between successive nodes.
+   Rows touched by a change are queued and their implied column bounds are
+   imposed via the B&B undo ladders, so that they are unwound with the branch. */
+STATIC void tallyitem_BB(BBproprec *prop, int rownr, REAL value, REAL lobound, REAL upbound, int sign)
 {
-  return( 0 );
+  REAL infinity = prop->lp->infinite;
+
+  if(value < 0)
+    swapREAL(&lobound, &upbound);
+  if(fabs(lobound) >= infinity)
+    prop->mininfinite[rownr] += sign;
+  else
+    prop->minfinite[rownr] += sign*value*lobound;
+  if(fabs(upbound) >= infinity)
+    prop->maxinfinite[rownr] += sign;
+  else
+    prop->maxfinite[rownr] += sign*value*upbound;
+}
+
+STATIC void tallyrow_BB(BBproprec *prop, int rownr)
+{
+  int     colnr;
+  NZINDEX ix, ie;
+  MATrec  *mat = prop->lp->matA;
+
+  prop->minfinite[rownr]   = 0;
+  prop->maxfinite[rownr]   = 0;
+  prop->mininfinite[rownr] = 0;
+  prop->maxinfinite[rownr] = 0;
+  prop->updates[rownr]     = 0;
+  ie = mat->row_end[rownr];
+  for(ix = mat->row_end[rownr - 1]; ix < ie; ix++) {
+    colnr = ROW_MAT_COLNR(ix);
+    tallyitem_BB(prop, rownr, ROW_MAT_VALUE(ix), prop->lowbo[colnr], prop->upbo[colnr], 1);
+  }
+}
+
+STATIC void queuerow_BB(BBproprec *prop, int rownr)
+{
+  int rows = prop->lp->rows;
+
+  if(!prop->inqueue[rownr]) {
+    prop->queue[(prop->queuefirst + prop->queuecount) % rows] = rownr;
+    prop->queuecount++;
+    prop->inqueue[rownr] = TRUE;
+  }
+}
+
+STATIC void tallycolumn_BB(BBproprec *prop, int colnr, REAL lobound, REAL upbound)
+{
+  int     rownr;
+  NZINDEX ix, ie;
+  REAL    value;
+  MATrec  *mat = prop->lp->matA;
+
+  ie = mat->col_end[colnr];
+  for(ix = mat->col_end[colnr - 1]; ix < ie; ix++) {
+    rownr = COL_MAT_ROWNR(ix);
+    if(rownr == 0)
+      continue;
+    value = COL_MAT_VALUE(ix);
+    tallyitem_BB(prop, rownr, value, prop->lowbo[colnr], prop->upbo[colnr], -1);
+    tallyitem_BB(prop, rownr, value, lobound, upbound, 1);
+    prop->updates[rownr]++;
+    queuerow_BB(prop, rownr);
+  }
+  prop->lowbo[colnr] = lobound;
+  prop->upbo[colnr]  = upbound;
+}
+
+STATIC MYBOOL initpropagate_BB(BBrec *BB)
+{
+  int       i, j;
+  lprec     *lp = BB->lp;
+  BBproprec *prop;
+
+  freepropagate_BB(lp);
+  if(!mat_validate(lp->matA))
+    return( FALSE );
+  prop = (BBproprec *) calloc(1, sizeof(*prop));
+  if(prop == NULL)
+    return( FALSE );
+  prop->lp = lp;
+  lp->bb_propagate = prop;
+  if(!allocREAL(lp, &prop->minfinite, lp->rows + 1, FALSE) ||
+     !allocREAL(lp, &prop->maxfinite, lp->rows + 1, FALSE) ||
+     !allocINT(lp, &prop->mininfinite, lp->rows + 1, FALSE) ||
+     !allocINT(lp, &prop->maxinfinite, lp->rows + 1, FALSE) ||
+     !allocINT(lp, &prop->updates, lp->rows + 1, FALSE) ||
+     !allocINT(lp, &prop->queue, lp->rows + 1, FALSE) ||
+     !allocMYBOOL(lp, &prop->inqueue, lp->rows + 1, TRUE) ||
+     !allocREAL(lp, &prop->upbo, lp->columns + 1, FALSE) ||
+     !allocREAL(lp, &prop->lowbo, lp->columns + 1, FALSE) ||
+     !allocMYBOOL(lp, &prop->vartype, lp->columns + 1, TRUE)) {
+    freepropagate_BB(lp);
+    return( FALSE );
+  }
+  if(is_bb_mode(lp, NODE_CONFLICTS) &&
+     (!allocINT(lp, &prop->conflictend, BBCONF_MAXPOOL + 1, TRUE) ||
+      !allocINT(lp, &prop->conflictitem, BBCONF_MAXPOOL*BBCONF_MAXLENGTH, FALSE) ||
+      !allocREAL(lp, &prop->conflictbound, BBCONF_MAXPOOL*BBCONF_MAXLENGTH, FALSE) ||
+      !allocREAL(lp, &prop->rowwork, lp->rows + 1, FALSE) ||
+      !allocINT(lp, &prop->colindex, lp->columns + 1, FALSE) ||
+      !allocREAL(lp, &prop->colvalue, lp->columns + 1, FALSE) ||
+      !allocREAL(lp, &prop->colwork, lp->columns + 1, FALSE))) {
+    freepropagate_BB(lp);
+    return( FALSE );
+  }
+
+  /* Copy the bounds and determine which columns we may tighten; semi-continuous,
+     SOS and GUB member bounds have special meaning to the B&B and are left alone */
+  for(j = 1; j <= lp->columns; j++) {
+    prop->upbo[j]  = BB->upbo[lp->rows + j];
+    prop->lowbo[j] = BB->lowbo[lp->rows + j];
+    if(is_semicont(lp, j) || SOS_is_member(lp->SOS, 0, j) || SOS_is_member(lp->GUB, 0, j))
+      continue;
+    prop->vartype[j] = (is_int(lp, j) ? 2 : 1);
+  }
+
+  /* Compute the activity tallies and have every row visited once */
+  for(i = 1; i <= lp->rows; i++) {
+    tallyrow_BB(prop, i);
+    queuerow_BB(prop, i);
+  }
+  return( TRUE );
+}
+
+STATIC void freepropagate_BB(lprec *lp)
+{
+  BBproprec *prop = lp->bb_propagate;
+
+  if(prop == NULL)
+    return;
+  FREE(prop->minfinite);
+  FREE(prop->maxfinite);
+  FREE(prop->mininfinite);
+  FREE(prop->maxinfinite);
+  FREE(prop->updates);
+  FREE(prop->queue);
+  FREE(prop->inqueue);
+  FREE(prop->upbo);
+  FREE(prop->lowbo);
+  FREE(prop->vartype);
+  FREE(prop->conflictend);
+  FREE(prop->conflictitem);
+  FREE(prop->conflictbound);
+  FREE(prop->rowwork);
+  FREE(prop->colindex);
+  FREE(prop->colvalue);
+  FREE(prop->colwork);
+  FREE(lp->bb_propagate);
+}
+
+/* Impose an implied bound on a column; returns 1 if the bound was tightened,
+   0 if it was not worth it and -1 if it conflicts with the opposite bound */
+STATIC int tightenbound_BB(BBrec *BB, int colnr, REAL newbound, MYBOOL isupper)
+{
+  lprec     *lp = BB->lp;
+  BBproprec *prop = lp->bb_propagate;
+  int       K = lp->rows + colnr;
+  REAL      lobound = prop->lowbo[colnr], upbound = prop->upbo[colnr],
+            epsvalue, range;
+
+  if(fabs(newbound) > BBPROP_MAXBOUND)
+    return( 0 );
+  epsvalue = BBPROP_FEASTOL*MAX(1, fabs(newbound));
+
+  /* Round to the integer grid, or relax by the tolerance for continuous columns */
+  if(prop->vartype[colnr] == 2) {
+    if(isupper)
+      newbound = scaled_floor(lp, K, unscaled_value(lp, newbound, K) + epsvalue, 1);
+    else
+      newbound = scaled_ceil(lp, K, unscaled_value(lp, newbound, K) - epsvalue, 1);
+    range = lp->epsprimal;
+  }
+  else {
+    my_roundzero(newbound, lp->epsprimal);
+    if(isupper)
+      newbound += epsvalue;
+    else
+      newbound -= epsvalue;
+    if((fabs(lobound) < lp->infinite) && (fabs(upbound) < lp->infinite))
+      range = BBPROP_MINCHANGE*MAX(1, upbound - lobound);
+    else
+      range = BBPROP_MINCHANGE*MAX(1, fabs(newbound));
+  }
+
+  /* Check for conflicts and worthwhile improvement, then apply; a bound within
+     epsilon of the opposite bound is snapped to it, since the simplex only
+     recognizes a fixed variable by an exactly zero range */
+  if(isupper) {
+    if(newbound < lobound - epsvalue)
+      return( -1 );
+    SETMAX(newbound, lobound);
+    if((newbound != lobound) && (fabs(newbound - lobound) < lp->epsvalue))
+      newbound = lobound;
+    if((upbound < lp->infinite) && (newbound > upbound - range))
+      return( 0 );
+    modifyUndoLadder(lp->bb_upperchange, K, BB->upbo, newbound);
+    tallycolumn_BB(prop, colnr, lobound, newbound);
+  }
+  else {
+    if(newbound > upbound + epsvalue)
+      return( -1 );
+    SETMIN(newbound, upbound);
+    if((newbound != upbound) && (fabs(newbound - upbound) < lp->epsvalue))
+      newbound = upbound;
+    if((lobound > -lp->infinite) && (newbound < lobound + range))
+      return( 0 );
+    modifyUndoLadder(lp->bb_lowerchange, K, BB->lowbo, newbound);
+    tallycolumn_BB(prop, colnr, newbound, upbound);
+  }
+  prop->tightened++;
+  return( 1 );
+}
+
+/* Conflict learning; an infeasible node yields a constraint sum(a*x) whose minimum
+   over the node bounds exceeds its right-hand side.  Bounds that are not needed for
+   this are relaxed to their root values, largest contribution kept first, and the
+   remaining node bounds are stored as a conflict, i.e. a set of bound literals that
+   cannot all hold.  The literals only refer to the root bounds and the constraints,
+   so the conflict is valid throughout the B&B tree.  The sign argument negates the
+   constraint, so that a maximum activity below the right-hand side can be used. */
+STATIC MYBOOL learnconflict_BB(BBrec *BB, int count, int *index, REAL *value, REAL rhs, int sign)
+{
+  lprec     *lp = BB->lp;
+  BBproprec *prop = lp->bb_propagate;
+  int       i, j, k, K, nkept = 0, kept[BBCONF_MAXLENGTH];
+  REAL      a, bound, root, minact = 0, magnitude = fabs(rhs), excess, total = 0,
+            *contrib = prop->colwork, infinity = lp->infinite;
+
+  if(prop->conflictcount >= BBCONF_MAXPOOL)
+    return( FALSE );
+
+  /* Compute the minimum activity and the part of it owed to each node bound */
+  rhs *= sign;
+  for(k = 1; k <= count; k++) {
+    j = index[k];
+    K = lp->rows + j;
+    a = sign*value[k];
+    if(a > 0) {
+      bound = BB->lowbo[K];
+      root  = lp->orig_lowbo[K];
+    }
+    else {
+      bound = BB->upbo[K];
+      root  = lp->orig_upbo[K];
+    }
+    if(fabs(bound) >= infinity)
+      return( FALSE );
+    minact += a*bound;
+    SETMAX(magnitude, fabs(a*bound));
+    if(fabs(root) >= infinity)
+      contrib[k] = infinity;
+    else {
+      contrib[k] = a*(bound - root);
+      if(contrib[k] < 0)
+        contrib[k] = 0;
+      total += contrib[k];
+    }
+  }
+  excess = minact - rhs - BBPROP_FEASTOL*MAX(1, magnitude);
+  if(excess <= 0)
+    return( FALSE );
+
+  /* Keep the bounds without a finite root value, then the largest contributions
+     until the relaxed remainder still exceeds the right-hand side */
+  for(k = 1; k <= count; k++) {
+    if(contrib[k] < infinity)
+      continue;
+    if(nkept >= BBCONF_MAXLENGTH)
+      return( FALSE );
+    kept[nkept++] = k;
+    contrib[k] = -1;
+  }
+  while(total >= excess) {
+    i = 0;
+    for(k = 1; k <= count; k++)
+      if((contrib[k] > 0) && ((i == 0) || (contrib[k] > contrib[i])))
+        i = k;
+    if((i == 0) || (nkept >= BBCONF_MAXLENGTH))
+      return( FALSE );
+    total -= contrib[i];
+    kept[nkept++] = i;
+    contrib[i] = -1;
+  }
+
+  /* A conflict without literals means that the model itself is infeasible,
+     which is left for the B&B to establish */
+  if(nkept == 0)
+    return( FALSE );
+
+  /* Verify the relaxed inference, and that the literals are on columns we may bound */
+  minact = 0;
+  for(k = 1; k <= count; k++) {
+    j = index[k];
+    K = lp->rows + j;
+    a = sign*value[k];
+    if(contrib[k] < 0) {
+      if(prop->vartype[j] == 0)
+        return( FALSE );
+      bound = (a > 0 ? BB->lowbo[K] : BB->upbo[K]);
+    }
+    else if(a > 0)
+      bound = MIN(BB->lowbo[K], lp->orig_lowbo[K]);
+    else
+      bound = MAX(BB->upbo[K], lp->orig_upbo[K]);
+    minact += a*bound;
+  }
+  if(minact - rhs <= BBPROP_FEASTOL*MAX(1, magnitude))
+    return( FALSE );
+
+  /* Store the conflict */
+  i = prop->conflictend[prop->conflictcount];
+  for(k = 0; k < nkept; k++, i++) {
+    j = index[kept[k]];
+    K = lp->rows + j;
+    if(sign*value[kept[k]] > 0) {
+      prop->conflictitem[i]  = j;
+      prop->conflictbound[i] = BB->lowbo[K];
+    }
+    else {
+      prop->conflictitem[i]  = -j;
+      prop->conflictbound[i] = BB->upbo[K];
+    }
+  }
+  prop->conflictcount++;
+  prop->conflictend[prop->conflictcount] = i;
+  prop->conflicts++;
+  return( TRUE );
+}
+
+/* Check the node bounds against the conflict pool; returns -1 if all literals of
+   a conflict hold, else the number of integer bounds tightened because all but
+   one literal of a conflict hold and the remaining one must then be violated */
+STATIC int checkconflicts_BB(BBrec *BB)
+{
+  lprec     *lp = BB->lp;
+  BBproprec *prop = lp->bb_propagate;
+  int       i, ie, j, K, n, last = 0, result, ntightened = 0;
+  REAL      bound;
+
+  for(n = 0; n < prop->conflictcount; n++) {
+    ie = prop->conflictend[n + 1];
+    result = 0;
+    for(i = prop->conflictend[n]; i < ie; i++) {
+      j = prop->conflictitem[i];
+      K = lp->rows + abs(j);
+      if((j > 0) ? (BB->lowbo[K] >= prop->conflictbound[i] - lp->epsprimal) :
+                   (BB->upbo[K] <= prop->conflictbound[i] + lp->epsprimal))
+        continue;
+      last = i;
+      if(++result > 1)
+        break;
+    }
+    if(result == 0)
+      return( -1 );
+    if(result > 1)
+      continue;
+
+    /* Impose the complement of the single open literal on an integer column */
+    j = prop->conflictitem[last];
+    K = lp->rows + abs(j);
+    if(prop->vartype[abs(j)] != 2)
+      continue;
+    bound = unscaled_value(lp, prop->conflictbound[last], K);
+    if(j > 0)
+      result = tightenbound_BB(BB, j, scaled_value(lp, bound - 1, K), TRUE);
+    else
+      result = tightenbound_BB(BB, -j, scaled_value(lp, bound + 1, K), FALSE);
+    if(result < 0)
+      return( -1 );
+    ntightened += result;
+  }
+  return( ntightened );
+}
+
+/* Learn a conflict from a node whose LP was found infeasible; the row of the basis
+   inverse belonging to the most infeasible basic variable gives the multipliers
+   of a Farkas-type aggregation of the constraints.  Since the inference is
+   verified from scratch, any inaccuracy of the multipliers only means that
+   nothing is learnt */
+STATIC void farkasconflict_BB(BBrec *BB)
+{
+  lprec     *lp = BB->lp;
+  BBproprec *prop = lp->bb_propagate;
+  MATrec    *mat = lp->matA;
+  int       i, j, rownr = 0, count = 0, loinfinite = 0, hiinfinite = 0;
+  NZINDEX   ix, ie;
+  REAL      value, lorow, uprow, loaggr = 0, hiaggr = 0, maxinfeas = lp->epsprimal,
+            *y = prop->rowwork, infinity = lp->infinite;
+
+  /* Find the basic variable with the largest bound violation */
+  for(i = 1; i <= lp->rows; i++) {
+    value = -lp->rhs[i];
+    if(lp->upbo[lp->var_basic[i]] < infinity)
+      SETMAX(value, lp->rhs[i] - lp->upbo[lp->var_basic[i]]);
+    if(value > maxinfeas) {
+      maxinfeas = value;
+      rownr = i;
+    }
+  }
+  if((rownr == 0) || is_action(lp->spx_action, ACTION_REINVERT))
+    return;
+
+  /* Obtain the multipliers and aggregate the row activity limits */
+  MEMCLEAR(y, lp->rows + 1);
+  bsolve(lp, rownr, y, NULL, lp->epsmachine*DOUBLEROUND, 1.0);
+  for(i = 1; i <= lp->rows; i++) {
+    value = y[i];
+    if(fabs(value) < lp->epsvalue) {
+      y[i] = 0;
+      continue;
+    }
+    uprow = lp->orig_rhs[i] - BB->lowbo[i];
+    if(BB->upbo[i] >= infinity)
+      lorow = -infinity;
+    else
+      lorow = lp->orig_rhs[i] - BB->upbo[i];
+    if(value < 0)
+      swapREAL(&lorow, &uprow);
+    if(fabs(lorow) >= infinity)
+      loinfinite++;
+    else
+      loaggr += value*lorow;
+    if(fabs(uprow) >= infinity)
+      hiinfinite++;
+    else
+      hiaggr += value*uprow;
+  }
+
+  /* Aggregate the column coefficients */
+  for(j = 1; j <= lp->columns; j++) {
+    value = 0;
+    ie = mat->col_end[j];
+    for(ix = mat->col_end[j - 1]; ix < ie; ix++)
+      if(COL_MAT_ROWNR(ix) > 0)
+        value += y[COL_MAT_ROWNR(ix)]*COL_MAT_VALUE(ix);
+    if(fabs(value) > lp->epsvalue) {
+      count++;
+      prop->colindex[count] = j;
+      prop->colvalue[count] = value;
+    }
+  }
+
+  /* Try the aggregated constraint in both directions */
+  if((hiinfinite == 0) && learnconflict_BB(BB, count, prop->colindex, prop->colvalue, hiaggr, 1))
+    return;
+  if(loinfinite == 0)
+    learnconflict_BB(BB, count, prop->colindex, prop->colvalue, loaggr, -1);
+}
+
+/* Propagate the bound changes of the node through the constraints; returns the
+   number of tightened bounds, or -1 if the node was found to be infeasible */
+STATIC int presolve_BB(BBrec *BB)
+{
+  int       i, j, K, result, ntightened = 0, nvisits, nrounds = 0;
+  NZINDEX   ix, ie;
+  lprec     *lp = BB->lp;
+  BBproprec *prop = lp->bb_propagate;
+  MATrec    *mat = lp->matA;
+  REAL      value, bound, lorow, uprow, resmin, resmax, infinity = lp->infinite;
+  MYBOOL    doupper, dolower, isupper = FALSE;
+
+  if((prop == NULL) && !initpropagate_BB(BB))
+    return( 0 );
+  prop = lp->bb_propagate;
+
+  /* Bring the tallies in line with the current node bounds */
+  for(j = 1; j <= lp->columns; j++) {
+    K = lp->rows + j;
+    if((BB->upbo[K] != prop->upbo[j]) || (BB->lowbo[K] != prop->lowbo[j]))
+      tallycolumn_BB(prop, j, BB->lowbo[K], BB->upbo[K]);
+  }
+
+  /* Process the queued rows until done or the work limit is reached, then
+     check the conflict pool, which may queue further rows */
+  nvisits = BBPROP_MAXVISITS*lp->rows;
+  do {
+    while((prop->queuecount > 0) && (nvisits-- > 0)) {
+      i = prop->queue[prop->queuefirst];
+      prop->queuefirst = (prop->queuefirst + 1) % lp->rows;
+      prop->queuecount--;
+      prop->inqueue[i] = FALSE;
+      if(prop->updates[i] > BBPROP_RETALLY)
+        tallyrow_BB(prop, i);
+
+      /* Get the row activity limits in the internal (sign changed) form */
+      uprow = lp->orig_rhs[i] - BB->lowbo[i];
+      if(BB->upbo[i] >= infinity)
+        lorow = -infinity;
+      else
+        lorow = lp->orig_rhs[i] - BB->upbo[i];
+
+      /* Check for infeasibility and redundancy */
+      isupper = TRUE;
+      if((prop->mininfinite[i] == 0) &&
+         (prop->minfinite[i] > uprow + BBPROP_FEASTOL*MAX(1, fabs(uprow))))
+        goto Infeasible;
+      isupper = FALSE;
+      if((prop->maxinfinite[i] == 0) &&
+         (prop->maxfinite[i] < lorow - BBPROP_FEASTOL*MAX(1, fabs(lorow))))
+        goto Infeasible;
+      doupper = (MYBOOL) ((uprow < infinity) && (prop->mininfinite[i] <= 1));
+      dolower = (MYBOOL) ((lorow > -infinity) && (prop->maxinfinite[i] <= 1));
+      if((prop->mininfinite[i] == 0) && (prop->maxinfinite[i] == 0) &&
+         (prop->maxfinite[i] <= uprow) && (prop->minfinite[i] >= lorow))
+        continue;
+
+      /* Derive the implied bounds of the row's columns from the residual activities */
+      ie = mat->row_end[i];
+      for(ix = mat->row_end[i - 1]; (doupper || dolower) && (ix < ie); ix++) {
+        j = ROW_MAT_COLNR(ix);
+        if(prop->vartype[j] == 0)
+          continue;
+        value = ROW_MAT_VALUE(ix);
+        if(doupper) {
+          bound = (value > 0 ? prop->lowbo[j] : prop->upbo[j]);
+          if(fabs(bound) >= infinity)
+            resmin = (prop->mininfinite[i] == 1 ? prop->minfinite[i] : infinity);
+          else
+            resmin = (prop->mininfinite[i] == 0 ? prop->minfinite[i] - value*bound : infinity);
+          if(resmin < infinity) {
+            result = tightenbound_BB(BB, j, (uprow - resmin) / value, (MYBOOL) (value > 0));
+            isupper = TRUE;
+            if(result < 0)
+              goto Infeasible;
+            ntightened += result;
+          }
+        }
+        if(dolower) {
+          bound = (value > 0 ? prop->upbo[j] : prop->lowbo[j]);
+          if(fabs(bound) >= infinity)
+            resmax = (prop->maxinfinite[i] == 1 ? prop->maxfinite[i] : -infinity);
+          else
+            resmax = (prop->maxinfinite[i] == 0 ? prop->maxfinite[i] - value*bound : -infinity);
+          if(resmax > -infinity) {
+            result = tightenbound_BB(BB, j, (lorow - resmax) / value, (MYBOOL) (value < 0));
+            isupper = FALSE;
+            if(result < 0)
+              goto Infeasible;
+            ntightened += result;
+          }
+        }
+        doupper = (MYBOOL) (doupper && (prop->mininfinite[i] <= 1));
+        dolower = (MYBOOL) (dolower && (prop->maxinfinite[i] <= 1));
+      }
+    }
+    if(prop->conflictcount == 0)
+      break;
+    result = checkconflicts_BB(BB);
+    if(result < 0) {
+      prop->conflicthits++;
+      i = 0;
+      goto Infeasible;
+    }
+    ntightened += result;
+  } while((result > 0) && (++nrounds < BBCONF_MAXROUNDS));
+  return( ntightened );
+
+Infeasible:
+  /* Learn from the violated row, taken in the direction that was violated */
+  if((i > 0) && (prop->conflictend != NULL)) {
+    j = 0;
+    ie = mat->row_end[i];
+    for(ix = mat->row_end[i - 1]; ix < ie; ix++) {
+      j++;
+      prop->colindex[j] = ROW_MAT_COLNR(ix);
+      prop->colvalue[j] = ROW_MAT_VALUE(ix);
+    }
+    if(isupper)
+      learnconflict_BB(BB, j, prop->colindex, prop->colvalue, lp->orig_rhs[i] - BB->lowbo[i], 1);
+    else if(BB->upbo[i] < infinity)
+      learnconflict_BB(BB, j, prop->colindex, prop->colvalue, lp->orig_rhs[i] - BB->upbo[i], -1);
+  }
+  prop->fathomed++;
+  return( -1 );
 }
 
 /* Node and branch management routines */
@@ -763,7 +1345,7 @@ STATIC MYBOOL freecuts_BB(lprec *lp)
 /* B&B solver routines */
 STATIC int solve_LP(lprec *lp, BBrec *BB)
 {
-  int    tilted, restored, status;
+  int    tilted, restored, status, spxtype = 0, improve = 0;
   REAL   testOF, *upbo = BB->upbo, *lowbo = BB->lowbo;
   BBrec  *perturbed = NULL;
 
@@ -792,6 +1374,35 @@ STATIC int solve_LP(lprec *lp, BBrec *BB)
   tilted   = 0;
   restored = 0;
 
+  /* Optionally perturb the costs and shift the bounds proactively; the shifts
+     are kept per variable and removed again in cleanup passes once optimal */
+  if((lp->bb_level <= 1) || is_anti_degen(lp, ANTIDEGEN_DURINGBB)) {
+    if(is_anti_degen(lp, ANTIDEGEN_COSTPERTURB) && (perturb_costs(lp) > 0)) {
+      set_action(&lp->spx_action, ACTION_REINVERT | ACTION_RECOMPUTE);
+      lp->perturb_count++;
+      lp->spx_perturbed = TRUE;
+    }
+    if(is_anti_degen(lp, ANTIDEGEN_BOUNDSHIFT) && (lp->bb_level <= 1)) {
+      perturbed = create_BB(lp, BB, TRUE);
+      if(perturb_bounds(lp, perturbed, TRUE, TRUE, TRUE) > 0) {
+        impose_bounds(lp, perturbed->upbo, perturbed->lowbo);
+        BB->UBzerobased = FALSE;
+        tilted++;
+        lp->perturb_count++;
+        lp->spx_perturbed = TRUE;
+      }
+      else {
+        free_BB(&perturbed);
+        perturbed = NULL;
+      }
+    }
+    if(lp->spx_trace && lp->spx_perturbed)
+      report(lp, DETAILED, "solve_LP: Starting with perturbed %s%s%s at level %d.\n",
+                           (lp->obj_perturb != NULL ? "costs" : ""),
+                           (lp->obj_perturb != NULL) && (tilted > 0) ? " and " : "",
+                           (tilted > 0 ? "bounds" : ""), lp->bb_level);
+  }
+
   while(status == RUNNING) {
 
     /* Copy user-specified entering bounds into lp_solve working bounds and run */
@@ -799,6 +1410,13 @@ STATIC int solve_LP(lprec *lp, BBrec *BB)
     lp->bb_status     = status;
     lp->spx_perturbed = FALSE;
 
+    /* Reinstate the simplex settings after a primal cleanup pass */
+    if(spxtype != 0) {
+      lp->simplex_strategy = spxtype;
+      lp->improve = improve;
+      spxtype = 0;
+    }
+
     if(tilted < 0)
       break;
 
@@ -826,6 +1444,29 @@ STATIC int solve_LP(lprec *lp, BBrec *BB)
       lp->spx_perturbed = TRUE;
     }
 
+    else if((lp->obj_perturb != NULL) && ((status == OPTIMAL) || (status == UNBOUNDED))) {
+      if(lp->spx_trace)
+        report(lp, DETAILED, "solve_LP: Restoring perturbed costs at level %d.\n",
+                              lp->bb_level);
+
+    /* Restore the original costs and clean up with a further pass from the basis
+       found for the perturbed problem; an unbounded outcome is also re-checked.
+       An optimal basis stays primal feasible, so use the primal simplex and
+       avoid bound flips that would sacrifice this for dual feasibility. */
+      FREE(lp->obj_perturb);
+      if(status == OPTIMAL) {
+        spxtype = lp->simplex_strategy;
+        improve = lp->improve;
+        lp->simplex_strategy = SIMPLEX_PRIMAL_PRIMAL;
+        clear_action(&lp->improve, IMPROVE_DUALFEAS);
+      }
+      set_action(&lp->spx_action, ACTION_REINVERT | ACTION_RECOMPUTE);
+      if(lp->bb_totalnodes == 0)
+        lp->real_solution = lp->infinite;
+      status = RUNNING;
+      lp->spx_perturbed = TRUE;
+    }
+
     else if(((lp->bb_level <= 1) ||     is_anti_degen(lp, ANTIDEGEN_DURINGBB)) &&
             (((status == LOSTFEAS) &&   is_anti_degen(lp, ANTIDEGEN_LOSTFEAS)) ||
              ((status == INFEASIBLE) && is_anti_degen(lp, ANTIDEGEN_INFEASIBLE)) ||
@@ -868,6 +1509,17 @@ STATIC int solve_LP(lprec *lp, BBrec *BB)
     }
   }
 
+  /* Never leave perturbed costs or shifted bounds behind, whatever the outcome */
+  if(lp->obj_perturb != NULL) {
+    FREE(lp->obj_perturb);
+    set_action(&lp->spx_action, ACTION_REINVERT | ACTION_RECOMPUTE);
+  }
+  if((perturbed != NULL) && (perturbed != BB)) {
+    while((perturbed != NULL) && (perturbed != BB))
+      free_BB(&perturbed);
+    impose_bounds(lp, upbo, lowbo);
+  }
+
   /* Handle the different simplex outcomes */
   if(status != OPTIMAL) {
     if(lp->bb_level <= 1)
@@ -1040,6 +1692,146 @@ STATIC int rcfbound_BB(BBrec *BB, int varno, MYBOOL isINT, REAL *newbound, MYBOO
   return( i );
 }
 
+/* Store the reduced costs of the root LP; the objective of any solution with a
+   non-basic column moved off its root bound by t is at least that of the root
+   plus t times the reduced cost, which limits the range in which an improved
+   solution can be found anywhere in the B&B tree */
+STATIC MYBOOL initrcfglobal_BB(BBrec *BB)
+{
+  lprec    *lp = BB->lp;
+  BBrcfrec *rcf;
+  int      j, K, n;
+  REAL     deltaRC;
+
+  freercfglobal_BB(lp);
+  rcf = (BBrcfrec *) calloc(1, sizeof(*rcf));
+  if((rcf == NULL) ||
+     !allocINT(lp, &rcf->colnr, lp->columns + 1, FALSE) ||
+     !allocREAL(lp, &rcf->cost, lp->columns + 1, FALSE) ||
+     !allocREAL(lp, &rcf->rootbound, lp->columns + 1, FALSE) ||
+     !allocMYBOOL(lp, &rcf->atlower, lp->columns + 1, FALSE) ||
+     !allocREAL(lp, &rcf->upbo, lp->columns + 1, FALSE) ||
+     !allocREAL(lp, &rcf->lowbo, lp->columns + 1, FALSE)) {
+    lp->bb_rcfglobal = rcf;
+    freercfglobal_BB(lp);
+    return( FALSE );
+  }
+  lp->bb_rcfglobal = rcf;
+  rcf->rootOF = lp->rhs[0];
+
+  n = 0;
+  for(j = 1; j <= lp->columns; j++) {
+    K = lp->rows + j;
+    if(lp->is_basic[K] || !is_int(lp, j) || is_semicont(lp, j) ||
+       (BB->upbo[K] - BB->lowbo[K] < lp->epsprimal))
+      continue;
+    deltaRC = my_chsign(!lp->is_lower[K], lp->drow[K]);
+    if(deltaRC < lp->epspivot)
+      continue;
+    if(fabs(lp->is_lower[K] ? BB->lowbo[K] : BB->upbo[K]) >= lp->infinite)
+      continue;
+    n++;
+    rcf->colnr[n]     = j;
+    rcf->cost[n]      = deltaRC;
+    rcf->atlower[n]   = lp->is_lower[K];
+    rcf->rootbound[n] = (lp->is_lower[K] ? BB->lowbo[K] : BB->upbo[K]);
+    rcf->upbo[j]      = BB->upbo[K];
+    rcf->lowbo[j]     = BB->lowbo[K];
+  }
+  rcf->count = n;
+  return( TRUE );
+}
+
+/* Tighten the global bounds of the candidates for the gap between the root
+   LP and an improved incumbent; returns the number of bounds changed */
+STATIC int updatercfglobal_BB(lprec *lp)
+{
+  BBrcfrec *rcf = lp->bb_rcfglobal;
+  int      i, j, K, n = 0;
+  REAL     deltaOF, deltaRC;
+
+  deltaOF = rcf->rootOF - lp->bb_workOF;
+  if(deltaOF < 0)
+    return( n );
+
+  for(i = 1; i <= rcf->count; i++) {
+    j = rcf->colnr[i];
+    K = lp->rows + j;
+    if(rcf->upbo[j] == rcf->lowbo[j])
+      continue;
+    deltaRC = deltaOF / rcf->cost[i];
+    if(deltaRC >= rcf->upbo[j] - rcf->lowbo[j])
+      continue;
+    deltaRC = scaled_floor(lp, K, unscaled_value(lp, deltaRC, K)+lp->epsprimal, 1);
+
+    /* The bound is snapped when within epsilon, since the simplex only recognizes
+       a fixed variable by an exactly zero range */
+    if(rcf->atlower[i]) {
+      deltaRC += rcf->rootbound[i];
+      if(deltaRC - rcf->lowbo[j] < lp->epsvalue)
+        deltaRC = rcf->lowbo[j];
+      if(deltaRC >= rcf->upbo[j] - lp->epsprimal)
+        continue;
+      rcf->upbo[j] = deltaRC;
+    }
+    else {
+      deltaRC = rcf->rootbound[i] - deltaRC;
+      if(rcf->upbo[j] - deltaRC < lp->epsvalue)
+        deltaRC = rcf->upbo[j];
+      if(deltaRC <= rcf->lowbo[j] + lp->epsprimal)
+        continue;
+      rcf->lowbo[j] = deltaRC;
+    }
+    if(rcf->upbo[j] == rcf->lowbo[j])
+      rcf->fixed++;
+    else
+      rcf->tightened++;
+    n++;
+  }
+  return( n );
+}
+
+/* Impose the global bounds on the node; returns -1 if the node cannot contain
+   an improved solution, else the number of node bounds tightened */
+STATIC int applyrcfglobal_BB(BBrec *BB)
+{
+  lprec    *lp = BB->lp;
+  BBrcfrec *rcf = lp->bb_rcfglobal;
+  int      i, j, K, n = 0;
+
+  for(i = 1; i <= rcf->count; i++) {
+    j = rcf->colnr[i];
+    K = lp->rows + j;
+    if((rcf->upbo[j] < BB->lowbo[K] - lp->epsprimal) ||
+       (rcf->lowbo[j] > BB->upbo[K] + lp->epsprimal))
+      return( -1 );
+    if(rcf->upbo[j] < BB->upbo[K]) {
+      modifyUndoLadder(lp->bb_upperchange, K, BB->upbo, MAX(rcf->upbo[j], BB->lowbo[K]));
+      n++;
+    }
+    if(rcf->lowbo[j] > BB->lowbo[K]) {
+      modifyUndoLadder(lp->bb_lowerchange, K, BB->lowbo, MIN(rcf->lowbo[j], BB->upbo[K]));
+      n++;
+    }
+  }
+  return( n );
+}
+
+STATIC void freercfglobal_BB(lprec *lp)
+{
+  BBrcfrec *rcf = lp->bb_rcfglobal;
+
+  if(rcf == NULL)
+    return;
+  FREE(rcf->colnr);
+  FREE(rcf->cost);
+  FREE(rcf->rootbound);
+  FREE(rcf->atlower);
+  FREE(rcf->upbo);
+  FREE(rcf->lowbo);
+  FREE(lp->bb_rcfglobal);
+}
+
 
 STATIC MYBOOL findnode_BB(BBrec *BB, int *varno, int *vartype, int *varcus)
 {
@@ -1211,6 +2003,11 @@ STATIC MYBOOL findnode_BB(BBrec *BB, int *varno, int *vartype, int *varcus)
         lp->bb_improvements++;
         lp->bb_workOF = lp->rhs[0];
 
+        /* Tighten bounds globally for the gap to the root LP */
+        if((lp->bb_rcfglobal != NULL) && (updatercfglobal_BB(lp) > 0) && lp->bb_trace)
+          report(lp, DETAILED, "findnode_BB: Root reduced costs have fixed %.0f and tightened %.0f columns\n",
+                               (double) lp->bb_rcfglobal->fixed, (double) lp->bb_rcfglobal->tightened);
+
         if(lp->bb_breakfirst ||
            (!is_infinite(lp, lp->bb_breakOF) && bb_better(lp, OF_USERBREAK, OF_TEST_BE)))
           lp->bb_break = TRUE;
@@ -1279,7 +2076,7 @@ STATIC MYBOOL findnode_BB(BBrec *BB, int *varno, int *vartype, int *varcus)
 
 STATIC int solve_BB(BBrec *BB)
 {
-  int   K, status;
+  int   K, status, ntightened;
   lprec *lp = BB->lp;
 
   /* Protect against infinite recursions do to integer rounding effects */
@@ -1307,9 +2104,45 @@ STATIC int solve_BB(BBrec *BB)
 
   }
 
+  /* Impose the bounds implied by the root reduced costs and the incumbent */
+  if((K > 0) && (lp->bb_rcfglobal != NULL) && (applyrcfglobal_BB(BB) < 0)) {
+    if(lp->bb_trace)
+      report(lp, DETAILED, "solve_BB: Root reduced costs fathomed B&B level %d\n",
+                           lp->bb_level);
+    lp->spx_status = INFEASIBLE;
+    return( INFEASIBLE );
+  }
+
+  /* Propagate the node bounds through the constraints, if specified; an
+     infeasible root is left for the simplex to establish and report */
+  if(is_bb_mode(lp, NODE_PROPAGATE | NODE_CONFLICTS) && (MIP_count(lp) > 0)) {
+    ntightened = presolve_BB(BB);
+    if((ntightened < 0) && (K > 0)) {
+      if(lp->bb_trace)
+        report(lp, DETAILED, "solve_BB: Bound propagation found B&B level %d infeasible\n",
+                             lp->bb_level);
+      lp->spx_status = INFEASIBLE;
+      return( INFEASIBLE );
+    }
+    else if((ntightened > 0) && lp->bb_trace)
+      report(lp, DETAILED, "solve_BB: Bound propagation tightened %d bounds at B&B level %d\n",
+                           ntightened, lp->bb_level);
+  }
+
   /* Solve! */
   status = solve_LP(lp, BB);
 
+  /* Keep the root reduced costs for global fixing; this is optional, since the
+     tightened bounds remain in the LP from which sensitivity is reported */
+  if((status == OPTIMAL) && (K == 0) && (lp->bb_level <= 1) && (lp->int_vars > 0) &&
+     is_bb_mode(lp, NODE_RCOSTGLOBAL))
+    initrcfglobal_BB(BB);
+
+  /* Learn a conflict from an infeasible node LP */
+  if((status == INFEASIBLE) && (K > 0) && (lp->bb_propagate != NULL) &&
+     (lp->bb_propagate->conflictend != NULL))
+    farkasconflict_BB(BB);
+
   /* Do special feasibility assessment of high order SOS'es */
 #if 1
   if((status == OPTIMAL) && (BB->vartype == BB_SOS) && !SOS_is_feasible(lp->SOS, 0, lp->solution))
@@ -1443,6 +2276,19 @@ STATIC int run_BB(lprec *lp)
   /* Finalize */
   freeUndoLadder(&(lp->bb_upperchange));
   freeUndoLadder(&(lp->bb_lowerchange));
+  if(lp->bb_propagate != NULL) {
+    report(lp, NORMAL, "\nBound propagation tightened %.0f bounds and fathomed %.0f nodes.\n",
+                       (double) lp->bb_propagate->tightened, (double) lp->bb_propagate->fathomed);
+    if(lp->bb_propagate->conflictend != NULL)
+      report(lp, NORMAL, "Conflict analysis learnt %.0f conflicts that fathomed %.0f nodes.\n",
+                         (double) lp->bb_propagate->conflicts, (double) lp->bb_propagate->conflicthits);
+    freepropagate_BB(lp);
+  }
+  if(lp->bb_rcfglobal != NULL) {
+    report(lp, NORMAL, "\nRoot reduced costs fixed %.0f and tightened %.0f integer columns globally.\n",
+                       (double) lp->bb_rcfglobal->fixed, (double) lp->bb_rcfglobal->tightened);
+    freercfglobal_BB(lp);
+  }
 
   /* Check if we should adjust status */
   if(lp->solutioncount > prevsolutions) {
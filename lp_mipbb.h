@@ -33,6 +33,59 @@ typedef struct _BBrec
   MYBOOL    UBzerobased;           /* State variable indicating if bounds have been rebased */
 } BBrec;
 
+/* Node bound propagation parameters */
+#define BBPROP_MAXVISITS        5  /* Row visits per node, as a multiple of the row count */
+#define BBPROP_RETALLY         64  /* Incremental updates before a row tally is recomputed */
+#define BBPROP_FEASTOL     1.0e-6  /* Relative tolerance for activity based deductions */
+#define BBPROP_MINCHANGE   1.0e-3  /* Relative range reduction required for continuous bounds */
+#define BBPROP_MAXBOUND    1.0e+9  /* Implied bounds larger than this are not applied */
+
+/* Conflict learning parameters */
+#define BBCONF_MAXPOOL       1000  /* Maximum number of conflicts kept in the pool */
+#define BBCONF_MAXLENGTH       10  /* Conflicts with more bound literals are discarded */
+#define BBCONF_MAXROUNDS        3  /* Rounds of pool checks and row propagation per node */
+
+/* Row activity tallies for propagating bound changes at the B&B nodes */
+typedef struct _BBproprec
+{
+  lprec     *lp;
+  REAL      *minfinite, *maxfinite; /* Finite parts of the minimum and maximum row activities */
+  int       *mininfinite, *maxinfinite; /* Number of infinite contributions to the activities */
+  int       *updates;              /* Incremental updates since the row was last re-tallied */
+  REAL      *upbo,   *lowbo;       /* Column bounds currently reflected in the tallies */
+  MYBOOL    *vartype;              /* 0 = fixed for propagation, 1 = continuous, 2 = integer */
+  int       *queue;                /* Circular list of rows waiting to be propagated */
+  MYBOOL    *inqueue;
+  int       queuefirst, queuecount;
+  COUNTER   tightened;             /* Number of bounds tightened during the B&B */
+  COUNTER   fathomed;              /* Number of nodes found infeasible without an LP */
+
+  /* Pool of learnt conflicts; each is a set of bound literals that cannot all hold */
+  int       *conflictend;          /* Literal index ranges of the conflicts, as in col_end */
+  int       *conflictitem;         /* Column of the literal; positive for x >= bound, negative for x <= bound */
+  REAL      *conflictbound;
+  int       conflictcount;
+  REAL      *rowwork;              /* Work arrays for deriving conflicts */
+  int       *colindex;
+  REAL      *colvalue, *colwork;
+  COUNTER   conflicts;             /* Number of conflicts learnt */
+  COUNTER   conflicthits;          /* Number of nodes fathomed by the pool */
+} BBproprec;
+
+/* Root reduced costs for tightening integer column bounds globally as the incumbent improves */
+typedef struct _BBrcfrec
+{
+  REAL      rootOF;                /* Objective value of the root LP, in the internal form */
+  int       count;                 /* Number of candidate columns */
+  int       *colnr;                /* Non-basic integer columns with a usable root reduced cost */
+  REAL      *cost;                 /* Reduced cost, signed to be positive */
+  REAL      *rootbound;            /* Root bound at which the column is non-basic */
+  MYBOOL    *atlower;
+  REAL      *upbo,   *lowbo;       /* Globally valid bounds of the candidates, by column */
+  COUNTER   fixed;                 /* Number of columns fixed globally */
+  COUNTER   tightened;             /* Number of other global bound tightenings */
+} BBrcfrec;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -49,7 +102,17 @@ STATIC MYBOOL freecuts_BB(lprec *lp);
 STATIC BBrec *findself_BB(BBrec *BB);
 STATIC int solve_LP(lprec *lp, BBrec *BB);
 STATIC int rcfbound_BB(BBrec *BB, int varno, MYBOOL isINT, REAL *newbound, MYBOOL *isfeasible);
+STATIC MYBOOL initrcfglobal_BB(BBrec *BB);
+STATIC int updatercfglobal_BB(lprec *lp);
+STATIC int applyrcfglobal_BB(BBrec *BB);
+STATIC void freercfglobal_BB(lprec *lp);
 STATIC MYBOOL findnode_BB(BBrec *BB, int *varno, int *vartype, int *varcus);
+STATIC MYBOOL initpropagate_BB(BBrec *BB);
+STATIC MYBOOL learnconflict_BB(BBrec *BB, int count, int *index, REAL *value, REAL rhs, int sign);
+STATIC int checkconflicts_BB(BBrec *BB);
+STATIC void farkasconflict_BB(BBrec *BB);
+STATIC int presolve_BB(BBrec *BB);
+STATIC void freepropagate_BB(lprec *lp);
 STATIC int solve_BB(BBrec *BB);
 STATIC MYBOOL free_BB(BBrec **BB);
 STATIC BBrec *pop_BB(BBrec *BB);
@@ -72,6 +72,8 @@ static struct _values anti_degen[] =
   { setvalue(ANTIDEGEN_DURINGBB) },
   { setvalue(ANTIDEGEN_RHSPERTURB) },
   { setvalue(ANTIDEGEN_BOUNDFLIP) },
+  { setvalue(ANTIDEGEN_COSTPERTURB) },
+  { setvalue(ANTIDEGEN_BOUNDSHIFT) },
 };
 
 static struct _values basiscrash[] =
@@ -80,6 +82,11 @@ static struct _values basiscrash[] =
   /* { setvalue(CRASH_NONBASICBOUNDS) }, */ /* not yet implemented */
   { setvalue(CRASH_MOSTFEASIBLE) },
   { setvalue(CRASH_LEASTDEGENERATE) },
+  { setvalue(CRASH_SIFTING) },
+  { setvalue(CRASH_DECOMPOSE) },
+  { setvalue(CRASH_NETWORK) },
+  { setvalue(CRASH_BIXBY) },
+  { setvalue(CRASH_LTSF) },
 };
 
 static struct _values bb_floorfirst[] =
@@ -112,6 +119,18 @@ static struct _values bb_rule[] =
   { setvalue(NODE_AUTOORDER) },
   { setvalue(NODE_RCOSTFIXING) },
   { setvalue(NODE_STRONGINIT) },
+  { setvalue(NODE_PROPAGATE) },
+  { setvalue(NODE_CONFLICTS) },
+  { setvalue(NODE_RCOSTGLOBAL) },
+};
+
+static struct _values memory_policy[] =
+{
+  { setvalue(MEMORY_DEFAULT) },
+  { setvalue(MEMORY_ALIGNED) },
+  { setvalue(MEMORY_HUGEPAGES) },
+  { setvalue(MEMORY_VALUEMAP) },
+  { setvalue(MEMORY_HASHINDEX) },
 };
 
 static struct _values improve[] =
@@ -121,6 +140,7 @@ static struct _values improve[] =
   { setvalue(IMPROVE_DUALFEAS) },
   { setvalue(IMPROVE_THETAGAP) },
   { setvalue(IMPROVE_BBSIMPLEX) },
+  { setvalue(IMPROVE_REFINE) },
 };
 
 static REAL __WINAPI get_mip_gap_abs(lprec *lp)
@@ -159,6 +179,7 @@ static struct _values pivoting[] =
   { setvalue(PRICE_LOOPALTERNATE) },
   { setvalue(PRICE_HARRISTWOPASS) },
   { setvalue(PRICE_TRUENORMINIT) },
+  { setvalue(PRICE_NOLONGSTEP) },
 };
 
 static struct _values presolving[] =
@@ -270,6 +291,7 @@ static struct _functions functions[] =
   { "BASISCRASH", setintfunction(get_basiscrash, set_basiscrash), setvalues(basiscrash, ~0), WRITE_ACTIVE },
   { "IMPROVE", setintfunction(get_improve, set_improve), setvalues(improve, ~0), WRITE_ACTIVE },
   { "MAXPIVOT", setintfunction(get_maxpivot, set_maxpivot), setNULLvalues, WRITE_ACTIVE },
+  { "MEMORYPOLICY", setintfunction(get_memory_policy, set_memory_policy), setvalues(memory_policy, ~0), WRITE_ACTIVE },
   { "NEGRANGE", setREALfunction(get_negrange, set_negrange), setNULLvalues, WRITE_ACTIVE },
   { "PIVOTING", setintfunction(get_pivoting, set_pivoting), setvalues(pivoting, PRICER_LASTOPTION), WRITE_ACTIVE },
   { "PRESOLVE", setintfunction(get_presolve, set_presolve1), setvalues(presolving, ~0), WRITE_ACTIVE },
@@ -3562,7 +3562,7 @@ STATIC MYBOOL presolve_finalize(presolverec *psdata)
   if((n > 0) && (ke > 0)) {
     del_columnex(lp, psdata->cols->varmap);
     mat_colcompact(lp->matA, lp->presolve_undo->orig_rows,
-                             lp->presolve_undo->orig_columns);
+                             lp->presolve_undo->orig_columns, NULL);
     compactvars = TRUE;
   }
 
@@ -5493,7 +5493,15 @@ write_lp(lp, "test_in.lp");    /* Write to lp-formatted file for debugging */
 
   /* Do traditional simple presolve */
   yieldformessages(lp);
-  if((lp->do_presolve & PRESOLVE_LASTMASKMODE) == PRESOLVE_NONE) {
+  i = lp->do_presolve & PRESOLVE_LASTMASKMODE;
+#ifdef NZINDEX64
+  /* The presolve row and column lists hold 32-bit non-zero positions */
+  if((i != PRESOLVE_NONE) && (mat_nonzeros(mat) > MAXINT32)) {
+    report(lp, NORMAL, "presolve: Skipped for a model with more than %d non-zeros\n", MAXINT32);
+    i = PRESOLVE_NONE;
+  }
+#endif
+  if(i == PRESOLVE_NONE) {
     mat_checkcounts(mat, NULL, NULL, TRUE);
     i = 0;
   }
@@ -34,6 +34,8 @@
     v1.1.0 15 October 2004      Added dual long step logic.
     v1.1.1 22 October 2004      Added bound sort order to variable selections.
     v1.2.0 24 March 2005        Completed multiple pricing logic.
+    v1.2.1 16 October 2026      Added magnitude bucketing of multiple pricing
+                                candidates in colprim.
    ------------------------------------------------------------------------- */
 
 
@@ -660,7 +662,8 @@ STATIC void makePriceLoop(lprec *lp, int *start, int *end, int *delta)
 /* Routine to verify accuracy of the current basis factorization */
 STATIC MYBOOL serious_facterror(lprec *lp, REAL *bvector, int maxcols, REAL tolerance)
 {
-  int    i, j, ib, ie, nz, nc;
+  int    i, j, nc;
+  NZINDEX ib, ie, nz;
   REAL   sum, tsum = 0, err = 0;
   MATrec *mat = lp->matA;
 
@@ -837,6 +840,8 @@ STATIC int colprim(lprec *lp, REAL *drow, int *nzdrow, MYBOOL skipupdate, int pa
   pricerec current, candidate;
   MYBOOL   collectMP = FALSE;
   int      *coltarget = NULL;
+  int      *bucketvar = NULL;
+  REAL     *bucketval = NULL;
 
   /* Identify pivot column according to pricing strategy; set
      entering variable initial threshold reduced cost value to "0" */
@@ -882,6 +887,23 @@ doLoop:
   ninfeas = 0;
   xinfeas = 0;
   sinfeas = 0;
+#ifdef UseMultiPriceBuckets
+  /* When collecting a new multiple pricing set from many more candidates than
+     the set can hold, first store the normalized reduced costs so that only
+     candidates of competitive magnitude are inserted into the sorted list */
+  if(collectMP && (lp->_piv_rule_ != PRICER_FIRSTINDEX) && (iy > 2*lp->multivars->size)) {
+    bucketvar = (int *) mempool_obtainVector(lp->workarrays, iy+1, sizeof(*bucketvar));
+    bucketval = (REAL *) mempool_obtainVector(lp->workarrays, iy+1, sizeof(*bucketval));
+    if((bucketvar == NULL) || (bucketval == NULL)) {
+      mempool_releaseVector(lp->workarrays, (char *) bucketvar, FALSE);
+      mempool_releaseVector(lp->workarrays, (char *) bucketval, FALSE);
+      bucketvar = NULL;
+      bucketval = NULL;
+    }
+    else
+      bucketvar[0] = 0;
+  }
+#endif
   makePriceLoop(lp, &ix, &iy, &iz);
   iy *= iz;
   for(; ix*iz <= iy; ix += iz) {
@@ -910,10 +932,38 @@ doLoop:
     sinfeas += f;
     candidate.pivot = normalizeEdge(lp, i, f, FALSE);
     candidate.varno = i;
+    if(bucketvar != NULL) {
+      bucketvar[0]++;
+      bucketvar[bucketvar[0]] = i;
+      bucketval[bucketvar[0]] = candidate.pivot;
+      continue;
+    }
     if(findImprovementVar(&current, &candidate, collectMP, candidatecount))
       break;
   }
 
+  /* Offer the stored candidates in their original scan order, skipping those
+     that are too small to ever make it into the multiple pricing set */
+  if(bucketvar != NULL) {
+    int threshold = multi_bucketThreshold(lp->multivars, bucketval, bucketvar[0]);
+
+    for(ix = 1; ix <= bucketvar[0]; ix++) {
+      candidate.pivot = bucketval[ix];
+      candidate.varno = bucketvar[ix];
+      frexp(candidate.pivot, &iz);
+      if(iz < threshold) {
+        if(validImprovementVar(&candidate))
+          (*candidatecount)++;
+      }
+      else if(findImprovementVar(&current, &candidate, collectMP, candidatecount))
+        break;
+    }
+    mempool_releaseVector(lp->workarrays, (char *) bucketval, FALSE);
+    mempool_releaseVector(lp->workarrays, (char *) bucketvar, FALSE);
+    bucketvar = NULL;
+    bucketval = NULL;
+  }
+
   /* Check if we should loop again after a multiple pricing update */
   if(lp->multivars != NULL) {
     if(collectMP) {
@@ -1491,6 +1541,12 @@ STATIC int coldual(lprec *lp, int row_nr, REAL *prow, int *nzprow,
   /* Loop over all entering column candidates */
   ix = 1;
   iy = nzprow[0];
+#ifdef UseLongDualBreakpoints
+  if(dolongsteps) {
+    multi_breakpoints(lp->longsteps, prow, nzprow, drow, g, epspivot, (MYBOOL) (dolongsteps == AUTOMATIC));
+    iy = 0;
+  }
+#endif
   makePriceLoop(lp, &ix, &iy, &iz);
   iy *= iz;
   for(; ix*iz <= iy; ix += iz) {
@@ -1555,7 +1611,8 @@ INLINE REAL normalizeEdge(lprec *lp, int item, REAL edge, MYBOOL isdual)
 /* Support routines for block detection and partial pricing */
 STATIC int partial_findBlocks(lprec *lp, MYBOOL autodefine, MYBOOL isrow)
 {
-  int    i, jj, n, nb, ne, items;
+  int    i, n, nb, ne, items;
+  NZINDEX jj, jb, je;
   REAL   hold, biggest, *sum = NULL;
   MATrec *mat = lp->matA;
   partialrec *blockdata;
@@ -1572,21 +1629,21 @@ STATIC int partial_findBlocks(lprec *lp, MYBOOL autodefine, MYBOOL isrow)
   for(i = 1; i <= items; i++) {
     n = 0;
     if(isrow) {
-      nb = mat->row_end[i-1];
-      ne = mat->row_end[i];
+      jb = mat->row_end[i-1];
+      je = mat->row_end[i];
     }
     else {
-      nb = mat->col_end[i-1];
-      ne = mat->col_end[i];
+      jb = mat->col_end[i-1];
+      je = mat->col_end[i];
     }
-    n = ne-nb;
+    n = (int) (je-jb);
     sum[i] = 0;
     if(n > 0) {
       if(isrow)
-        for(jj = nb; jj < ne; jj++)
+        for(jj = jb; jj < je; jj++)
           sum[i] += ROW_MAT_COLNR(jj);
       else
-        for(jj = nb; jj < ne; jj++)
+        for(jj = jb; jj < je; jj++)
           sum[i] += COL_MAT_ROWNR(jj);
       sum[i] /= n;
     }
@@ -2052,7 +2109,7 @@ Finish:
     QS_swap(multi->sortedList, bestindex, multi->used-1);
     multi_recompute(multi, bestindex, (bestcand->isdual == AUTOMATIC), TRUE);
 #else
-    multi->used = i + 1;
+    multi->used = bestindex + 1;
 #endif
   }
   multi_populateSet(multi, NULL, multi->active);
@@ -2078,6 +2135,186 @@ STATIC REAL multi_enteringtheta(multirec *multi)
   return( multi->step_base );
 }
 
+/* Determine the smallest binary exponent of a normalized reduced cost that can still
+   qualify for the multiple pricing set.  The candidates are counted in buckets by
+   exponent, and the buckets are accumulated from the top until they hold enough
+   candidates to fill the set.  One extra bucket is retained as a safety band, since
+   the candidate comparison operator applies tolerances and secondary criteria. */
+STATIC int multi_bucketThreshold(multirec *multi, REAL *pivots, int count)
+{
+  int i, n, bucket[MULTI_BUCKETMAX-MULTI_BUCKETMIN+1];
+
+  if((multi == NULL) || (count <= multi->size))
+    return( MULTI_BUCKETMIN );
+
+  MEMCLEAR(bucket, MULTI_BUCKETMAX-MULTI_BUCKETMIN+1);
+  for(i = 1; i <= count; i++) {
+    frexp(pivots[i], &n);
+    SETMAX(n, MULTI_BUCKETMIN);
+    SETMIN(n, MULTI_BUCKETMAX);
+    bucket[n-MULTI_BUCKETMIN]++;
+  }
+
+  n = 0;
+  for(i = MULTI_BUCKETMAX-MULTI_BUCKETMIN; i > 0; i--) {
+    n += bucket[i];
+    if(n >= multi->size)
+      break;
+  }
+  i += MULTI_BUCKETMIN - 1;
+  SETMAX(i, MULTI_BUCKETMIN);
+
+  return( i );
+}
+
+/* Breakpoint ordering for the long-step dual ratio test; ascending ratio, then
+   descending pivot size, and finally by position to give a strict total order */
+#define BREAKPOINT_LESS(a, b) ((theta[a] < theta[b]) || \
+                               ((theta[a] == theta[b]) && ((alpha[a] > alpha[b]) || \
+                                                           ((alpha[a] == alpha[b]) && (a < b)))))
+
+STATIC int breakpoint_partition(int *perm, REAL *theta, REAL *alpha, int lo, int hi)
+{
+  int i, j, t, mid = lo + (hi - lo) / 2;
+
+  /* Move the median of three to the end and partition around it */
+  if(BREAKPOINT_LESS(perm[mid], perm[lo])) {
+    t = perm[mid]; perm[mid] = perm[lo]; perm[lo] = t;
+  }
+  if(BREAKPOINT_LESS(perm[hi], perm[lo])) {
+    t = perm[hi]; perm[hi] = perm[lo]; perm[lo] = t;
+  }
+  if(BREAKPOINT_LESS(perm[mid], perm[hi])) {
+    t = perm[mid]; perm[mid] = perm[hi]; perm[hi] = t;
+  }
+  for(i = j = lo; j < hi; j++) {
+    if(BREAKPOINT_LESS(perm[j], perm[hi])) {
+      t = perm[j]; perm[j] = perm[i]; perm[i] = t;
+      i++;
+    }
+  }
+  t = perm[hi]; perm[hi] = perm[i]; perm[i] = t;
+  return( i );
+}
+
+STATIC void breakpoint_select(int *perm, REAL *theta, REAL *alpha, int lo, int hi, int kth)
+/* Partial selection; perm[lo..kth] holds the smallest breakpoints on return */
+{
+  int i;
+
+  while(lo < hi) {
+    i = breakpoint_partition(perm, theta, alpha, lo, hi);
+    if(i == kth)
+      break;
+    else if(i < kth)
+      lo = i + 1;
+    else
+      hi = i - 1;
+  }
+}
+
+STATIC void breakpoint_sort(int *perm, REAL *theta, REAL *alpha, int lo, int hi)
+{
+  int i, j, t;
+
+  while(hi - lo > 16) {
+    i = breakpoint_partition(perm, theta, alpha, lo, hi);
+    if(i - lo < hi - i) {
+      breakpoint_sort(perm, theta, alpha, lo, i - 1);
+      lo = i + 1;
+    }
+    else {
+      breakpoint_sort(perm, theta, alpha, i + 1, hi);
+      hi = i - 1;
+    }
+  }
+  for(i = lo + 1; i <= hi; i++) {
+    t = perm[i];
+    for(j = i; (j > lo) && BREAKPOINT_LESS(t, perm[j-1]); j--)
+      perm[j] = perm[j-1];
+    perm[j] = t;
+  }
+}
+
+/* Long-step dual ratio test over the condensed candidate list of coldual(); the ratios
+   and pivots are computed in a single pass, and only as many of the smallest breakpoints
+   as are needed to make the slope non-negative are put in order, by partial selection in
+   batches of increasing size.  The passed breakpoints are stored in ascending order with
+   their step and objective values, as collectMinorVar() and multi_recompute() would. */
+STATIC int multi_breakpoints(multirec *multi, REAL *prow, int *nzprow, REAL *drow,
+                             REAL g, REAL epspivot, MYBOOL isphase2)
+{
+  lprec    *lp = multi->lp;
+  int      i, k, m, n = nzprow[0], lo, hi, batch, *perm;
+  REAL     w, uB, prev_theta = 0, *theta, *alpha;
+  pricerec *thisprice;
+
+  perm  = (int *)  mempool_obtainVector(lp->workarrays, n+1, sizeof(*perm));
+  theta = (REAL *) mempool_obtainVector(lp->workarrays, n+1, sizeof(*theta));
+  alpha = (REAL *) mempool_obtainVector(lp->workarrays, n+1, sizeof(*alpha));
+
+  /* Compute the breakpoints; the candidates all have negative signed pivots */
+  m = 0;
+  for(k = 1; k <= n; k++) {
+    i = nzprow[k];
+    w = my_chsign(!lp->is_lower[i], prow[i] * g);
+    alpha[k] = -w;
+    theta[k] = fabs(drow[i] / w);
+    if((alpha[k] >= epspivot) && (theta[k] < lp->infinite))
+      perm[m++] = k;
+  }
+
+  /* Walk the breakpoints in ascending order, tracking the slope incrementally */
+  multi->maxpivot = 0;
+  multi->maxbound = 0;
+  lo = 0;
+  batch = LONGDUAL_BATCHMIN;
+  while((lo < m) && (multi->step_last < multi->epszero) && (multi->used < multi->size)) {
+    hi = MIN(lo + batch, m) - 1;
+    if(hi < m - 1)
+      breakpoint_select(perm, theta, alpha, lo, m - 1, hi);
+    breakpoint_sort(perm, theta, alpha, lo, hi);
+
+    for(; (lo <= hi) && (multi->step_last < multi->epszero) && (multi->used < multi->size); lo++) {
+      k = perm[lo];
+      i = nzprow[k];
+      uB = lp->upbo[i];
+      multi->obj_last += (theta[k] - prev_theta) * multi->step_last;
+      prev_theta = theta[k];
+      if(!isphase2)
+        multi->step_last += alpha[k];
+      else if(uB >= lp->infinite)
+        multi->step_last = lp->infinite;
+      else
+        multi->step_last += alpha[k]*uB;
+      SETMAX(multi->maxpivot, alpha[k]);
+      SETMAX(multi->maxbound, uB);
+
+      /* Store the breakpoint in the next free position */
+      thisprice = &(multi->items[multi->freeList[multi->freeList[0]--]]);
+      thisprice->theta    = theta[k];
+      thisprice->pivot    = -alpha[k];
+      thisprice->epspivot = epspivot;
+      thisprice->varno    = i;
+      thisprice->isdual   = TRUE;
+      thisprice->lp       = lp;
+      multi->sortedList[multi->used].pvoidreal.ptr = (void *) thisprice;
+      multi->sortedList[multi->used].pvoidreal.realval = multi->step_last;
+      multi->valueList[multi->used] = multi->obj_last;
+      multi->used++;
+    }
+    batch *= 2;
+  }
+  multi->sorted = TRUE;
+  multi->dirty  = FALSE;
+
+  mempool_releaseVector(lp->workarrays, (char *) alpha, FALSE);
+  mempool_releaseVector(lp->workarrays, (char *) theta, FALSE);
+  mempool_releaseVector(lp->workarrays, (char *) perm, FALSE);
+
+  return( multi->used );
+}
+
 STATIC int multi_populateSet(multirec *multi, int **list, int excludenr)
 {
   int n = 0;
@@ -5,6 +5,15 @@
 /* ------------------------------------------------------------------------- */
 #define UseSortOnBound_Improve
 /*#define UseSortOnBound_Substitute*/
+#define UseMultiPriceBuckets     /* Pre-filter multiple pricing candidates by magnitude */
+
+#define MULTI_BUCKETMIN        -64   /* Range of binary exponents used for bucketing */
+#define MULTI_BUCKETMAX         64
+
+#define UseLongDualBreakpoints   /* Dedicated partial-selection long-step dual ratio test */
+#define LONGDUAL_BATCHMIN       16   /* Initial number of breakpoints ordered per selection pass */
+#define LONGDUAL_MAXSTEPS     1000   /* Maximum number of long-step dual breakpoints per iteration */
+#define LONGDUAL_MINBOUNDED    0.5   /* Minimum fraction of bounded variables to use long steps */
 
 #if 0 /* Stricter feasibility-preserving tolerance; use w/ *_UseRejectionList */
   #define UseRelativeFeasibility       /* Use machine-precision and A-scale data */
@@ -90,6 +99,9 @@ STATIC int multi_enteringvar(multirec *multi, pricerec *current, int priority);
 STATIC REAL multi_enteringtheta(multirec *multi);
 STATIC void multi_free(multirec **multi);
 STATIC int multi_populateSet(multirec *multi, int **list, int excludenr);
+STATIC int multi_bucketThreshold(multirec *multi, REAL *pivots, int count);
+STATIC int multi_breakpoints(multirec *multi, REAL *prow, int *nzprow, REAL *drow,
+                             REAL g, REAL epspivot, MYBOOL isphase2);
 
 #ifdef __cplusplus
  }
@@ -37,6 +37,9 @@
     v1.2.0  1 March 2005        Changed memory allocation routines to use
                                 standard lp_solve functions, improve error handling
                                 and return boolean status values.
+    v1.2.1 16 October 2026      Cache true initial norms and reuse them when
+                                restarting with an unchanged basis; compute
+                                the norms of a slack basis without solves.
 
    ----------------------------------------------------------------------------------
 */
@@ -58,6 +61,56 @@ STATIC void simplexPricer(lprec *lp, MYBOOL isdual)
 STATIC void freePricer(lprec *lp)
 {
   FREE(lp->edgeVector);
+  FREE(lp->edgeCache);
+}
+
+
+STATIC void invalidatePricer(lprec *lp)
+{
+  FREE(lp->edgeCache);
+}
+
+
+STATIC MYBOOL cachedPricer(lprec *lp, MYBOOL isdual, MYBOOL store)
+/* Store or retrieve the true initial norms of the current basis; the cache is
+   laid out as [mode, rows, sum, norms...], and the basis signature follows
+   from the norms, which are strictly positive exactly for the basic variables
+   in the dual and exactly for the non-basic variables in the primal */
+{
+  int    i, n = lp->sum;
+  REAL   *cache;
+  MYBOOL hasnorm;
+
+  if(store) {
+    if(!allocREAL(lp, &(lp->edgeCache), n+3, AUTOMATIC))
+      return( FALSE );
+    cache = lp->edgeCache;
+    cache[0] = isdual;
+    cache[1] = lp->rows;
+    cache[2] = n;
+    for(i = 1; i <= n; i++) {
+      hasnorm = (MYBOOL) (lp->is_basic[i] == isdual);
+      cache[2+i] = my_if(hasnorm, lp->edgeVector[i], 0);
+    }
+    return( TRUE );
+  }
+
+  /* Check that the cache matches the current problem and basis */
+  cache = lp->edgeCache;
+  if((cache == NULL) || (cache[0] != isdual) ||
+     (cache[1] != lp->rows) || (cache[2] != n))
+    return( FALSE );
+  for(i = 1; i <= n; i++) {
+    hasnorm = (MYBOOL) (lp->is_basic[i] == isdual);
+    if(hasnorm != (MYBOOL) (cache[2+i] > 0))
+      return( FALSE );
+  }
+
+  /* Retrieve the norms */
+  for(i = 1; i <= n; i++)
+    if(cache[2+i] > 0)
+      lp->edgeVector[i] = cache[2+i];
+  return( TRUE );
 }
 
 
@@ -67,6 +120,7 @@ STATIC MYBOOL resizePricer(lprec *lp)
     return( TRUE );
 
   /* Reallocate vector for new size */
+  invalidatePricer(lp);
   if(!allocREAL(lp, &(lp->edgeVector), lp->sum_alloc+1, AUTOMATIC))
     return( FALSE );
 
@@ -170,7 +224,41 @@ STATIC MYBOOL restartPricer(lprec *lp, MYBOOL isdual)
     return( ok );
   }
 
-  /* Otherwise do the full Steepest Edge norm initialization */
+  /* Otherwise do the full Steepest Edge norm initialization, unless the
+     norms of this basis were already computed at an earlier restart */
+  isdual = (MYBOOL) (isdual != FALSE);
+  if(cachedPricer(lp, isdual, FALSE))
+    return( ok );
+
+  /* The slack basis is the identity, so that the dual norms are all unity
+     and the primal norms follow directly from the columns of A */
+  for(i = 1; i <= m; i++)
+    if(!lp->is_basic[i])
+      break;
+  if(i > m) {
+    if(isdual) {
+      for(i = 1; i <= m; i++)
+        lp->edgeVector[i] = 1.0;
+    }
+    else {
+      MATrec  *mat = lp->matA;
+      NZINDEX ix, ie;
+
+      for(i = m+1; i <= lp->sum; i++) {
+        seNorm = 1;
+        ie = mat->col_end[i-m];
+        for(ix = mat->col_end[i-m-1]; ix < ie; ix++) {
+          if(COL_MAT_ROWNR(ix) == 0)
+            continue;
+          hold = COL_MAT_VALUE(ix);
+          seNorm += hold*hold;
+        }
+        lp->edgeVector[i] = seNorm;
+      }
+    }
+    return( ok );
+  }
+
   ok = allocREAL(lp, &sEdge, m+1, FALSE);
   if(!ok)
     return( ok );
@@ -219,6 +307,9 @@ STATIC MYBOOL restartPricer(lprec *lp, MYBOOL isdual)
 
   FREE(sEdge);
 
+  /* Save the norms for reuse at a later restart with the same basis */
+  cachedPricer(lp, isdual, TRUE);
+
   return( ok );
 
 }
@@ -14,6 +14,8 @@ STATIC MYBOOL initPricer(lprec *lp);
 INLINE MYBOOL applyPricer(lprec *lp);
 STATIC void simplexPricer(lprec *lp, MYBOOL isdual);
 STATIC void freePricer(lprec *lp);
+STATIC void invalidatePricer(lprec *lp);
+STATIC MYBOOL cachedPricer(lprec *lp, MYBOOL isdual, MYBOOL store);
 STATIC MYBOOL resizePricer(lprec *lp);
 STATIC REAL getPricer(lprec *lp, int item, MYBOOL isdual);
 STATIC MYBOOL restartPricer(lprec *lp, MYBOOL isdual);
@@ -181,10 +181,10 @@ void blockWriteLREAL(FILE *output, char *label, LREAL *vector, int first, int la
 /* List the current user data matrix columns over the selected row range */
 void blockWriteAMAT(FILE *output, const char *label, lprec* lp, int first, int last)
 {
-  int    i, j, k = 0;
-  int    nzb, nze, jb;
-  double hold;
-  MATrec *mat = lp->matA;
+  int     i, j, k = 0, jb;
+  NZINDEX nzb, nze;
+  double  hold;
+  MATrec  *mat = lp->matA;
 
   if(!mat_validate(mat))
     return;
@@ -312,8 +312,8 @@ MYBOOL REPORT_debugdump(lprec *lp, char *filename, MYBOOL livedata)
                   get_nonzeros(lp), my_if(lp->invB == NULL, 0, lp->bfp_nonzeros(lp, FALSE)), lp->bfp_name());
   fprintf(output, "Internal sizes: %d rows allocated, %d columns allocated, %d columns used, %d eta length\n",
                   lp->rows_alloc, lp->columns_alloc, lp->columns, my_if(lp->invB == NULL, 0, lp->bfp_colcount(lp)));
-  fprintf(output, "Memory use:     %d sparse matrix, %d eta\n",
-                  lp->matA->mat_alloc, my_if(lp->invB == NULL, 0, lp->bfp_memallocated(lp)));
+  fprintf(output, "Memory use:     %.0f sparse matrix, %d eta\n",
+                  (double) lp->matA->mat_alloc, my_if(lp->invB == NULL, 0, lp->bfp_memallocated(lp)));
   fprintf(output, "Parameters:     Maximize=%d, Names used=%d, Scalingmode=%d, Presolve=%d, SimplexPivot=%d\n",
                   is_maxim(lp), lp->names_used, lp->scalemode, lp->do_presolve, lp->piv_strategy);
   fprintf(output, "Precision:      EpsValue=%g, EpsPrimal=%g, EpsDual=%g, EpsPivot=%g, EpsPerturb=%g\n",
@@ -324,7 +324,7 @@ MYBOOL REPORT_debugdump(lprec *lp, char *filename, MYBOOL livedata)
                   lp->bb_rule, my_boolstr(lp->bb_varbranch), lp->bb_floorfirst, lp->epsint, lp->mip_absgap, lp->mip_relgap);
 
   fprintf(output, "\nCORE DATA\n---------\n\n");
-  blockWriteINT(output,  "Column starts", lp->matA->col_end, 0, lp->columns);
+  blockWriteNZINDEX(output, "Column starts", lp->matA->col_end, 0, lp->columns);
   blockWriteINT(output,  "row_type", lp->row_type, 0, lp->rows);
   blockWriteREAL(output, "orig_rhs", lp->orig_rhs, 0, lp->rows);
   blockWriteREAL(output, "orig_lowbo", lp->orig_lowbo, 0, lp->sum);
@@ -513,6 +513,12 @@ void REPORT_extended(lprec *lp)
            my_precision((ret) ? dualstill[i - 1] : 0.0,lp->epsprimal));
 
   report(lp, NORMAL, " \n");
+  if(lp->workarrays != NULL) {
+    report(lp, NORMAL, "Work array pool: %.0f vectors obtained, %.0f bytes in use, %.0f bytes peak, %.0f bytes reserved\n",
+                       (double) lp->workarrays->obtained, (double) lp->workarrays->bytesinuse,
+                       (double) lp->workarrays->bytespeak, (double) lp->workarrays->bytesreserved);
+    report(lp, NORMAL, " \n");
+  }
 }
 
 /* A more readable lp-format report of the model; antiquated and not updated */
@@ -141,7 +141,8 @@ REAL CurtisReidMeasure(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColS
 
 int CurtisReidScales(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColScale)
 {
-  int    i, row, col, ent, nz;
+  int    i, row, col;
+  NZINDEX ix, ie, nz;
   REAL   *RowScalem2, *ColScalem2,
          *RowSum, *ColSum,
          *residual_even, *residual_odd;
@@ -160,7 +161,7 @@ int CurtisReidScales(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColSca
   return(0);
 
   /* Allocate temporary memory and find RowSum and ColSum measures */
-  nz = get_nonzeros(lp);
+  nz = mat_nonzeros(mat);
   colMax = lp->columns;
 
   allocREAL(lp, &RowSum, lp->rows+1, TRUE);
@@ -189,8 +190,8 @@ int CurtisReidScales(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColSca
   value = &(COL_MAT_VALUE(0));
   rownr = &(COL_MAT_ROWNR(0));
   colnr = &(COL_MAT_COLNR(0));
-  for(i = 0; i < nz;
-      i++, value += matValueStep, rownr += matRowColStep, colnr += matRowColStep) {
+  for(ix = 0; ix < nz;
+      ix++, value += matValueStep, rownr += matRowColStep, colnr += matRowColStep) {
     absvalue=fabs(*value);
     if(absvalue>0) {
       logvalue = log(absvalue);
@@ -229,11 +230,11 @@ int CurtisReidScales(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColSca
     if(lp->orig_obj[col] != 0)
       residual_even[col] -= RowSum[0] / (REAL) RowCount[0];
 
-    i = mat->col_end[col-1];
-    rownr = &(COL_MAT_ROWNR(i));
-    ent = mat->col_end[col];
-    for(; i < ent;
-        i++, rownr += matRowColStep) {
+    ix = mat->col_end[col-1];
+    rownr = &(COL_MAT_ROWNR(ix));
+    ie = mat->col_end[col];
+    for(; ix < ie;
+        ix++, rownr += matRowColStep) {
       residual_even[col] -= RowSum[*rownr] / (REAL) RowCount[*rownr];
     }
   }
@@ -292,8 +293,8 @@ int CurtisReidScales(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColSca
 
       rownr = &(COL_MAT_ROWNR(0));
       colnr = &(COL_MAT_COLNR(0));
-      for(i = 0; i < nz;
-          i++, rownr += matRowColStep, colnr += matRowColStep) {
+      for(ix = 0; ix < nz;
+          ix++, rownr += matRowColStep, colnr += matRowColStep) {
         residual_odd[*rownr] += (residual_even[*colnr] / (REAL) ColCount[*colnr]);
       }
       for(row = 0; row <= lp->rows; row++)
@@ -316,8 +317,8 @@ int CurtisReidScales(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColSca
 
       rownr = &(COL_MAT_ROWNR(0));
       colnr = &(COL_MAT_COLNR(0));
-      for(i = 0; i < nz;
-          i++, rownr += matRowColStep, colnr += matRowColStep) {
+      for(ix = 0; ix < nz;
+          ix++, rownr += matRowColStep, colnr += matRowColStep) {
         residual_even[*colnr] += (residual_odd[*rownr] / (REAL) RowCount[*rownr]);
       }
       for(col = 1; col <= colMax; col++)
@@ -376,10 +377,10 @@ int CurtisReidScales(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColSca
         }
       }
       else {
-        i = mat->row_end[row-1];
-        ent = mat->row_end[row];
-        for(; i < ent; i++) {
-          col = ROW_MAT_COLNR(i);
+        ix = mat->row_end[row-1];
+        ie = mat->row_end[row];
+        for(; ix < ie; ix++) {
+          col = ROW_MAT_COLNR(ix);
           check += FColScale[col];
         }
       }
@@ -395,11 +396,11 @@ int CurtisReidScales(lprec *lp, MYBOOL _Advanced, REAL *FRowScale, REAL *FColSca
       if(lp->orig_obj[col] != 0)
         check += FRowScale[0];
 
-      i = mat->col_end[col-1];
-      ent = mat->col_end[col];
-      rownr = &(COL_MAT_ROWNR(i));
-      for(; i < ent;
-          i++, rownr += matRowColStep) {
+      ix = mat->col_end[col-1];
+      ie = mat->col_end[col];
+      rownr = &(COL_MAT_ROWNR(ix));
+      for(; ix < ie;
+          ix++, rownr += matRowColStep) {
         check += FRowScale[*rownr];
       }
       check -= ColSum[col];
@@ -652,6 +653,7 @@ STATIC MYBOOL scale_columns(lprec *lp, REAL *scaledelta)
   }
 
   mat_validate(lp->matA);
+  lp->matA->vmap_cols = 0;
   nz = get_nonzeros(lp);
   value = &(COL_MAT_VALUE(0));
   colnr = &(COL_MAT_COLNR(0));
@@ -701,6 +703,7 @@ STATIC MYBOOL scale_rows(lprec *lp, REAL *scaledelta)
     lp->orig_obj[i] *= scalechange[0];
   }
 
+  lp->matA->vmap_cols = 0;
   nz = get_nonzeros(lp);
   value = &(COL_MAT_VALUE(0));
   rownr = &(COL_MAT_ROWNR(0));
@@ -733,6 +736,7 @@ STATIC MYBOOL scale_rows(lprec *lp, REAL *scaledelta)
 STATIC REAL scale(lprec *lp, REAL *scaledelta)
 {
   int     i, j, nz, row_count, nzOF = 0;
+  NZINDEX ix, ie;
   REAL    *row_max, *row_min, *scalechange = NULL, absval;
   REAL    col_max, col_min;
   MYBOOL  rowscaled, colscaled;
@@ -788,12 +792,12 @@ STATIC REAL scale(lprec *lp, REAL *scaledelta)
       nzOF++;
     }
 
-    i = mat->col_end[j - 1];
-    value = &(COL_MAT_VALUE(i));
-    rownr = &(COL_MAT_ROWNR(i));
-    nz = mat->col_end[j];
-    for(; i < nz;
-        i++, value += matValueStep, rownr += matRowColStep) {
+    ix = mat->col_end[j - 1];
+    value = &(COL_MAT_VALUE(ix));
+    rownr = &(COL_MAT_ROWNR(ix));
+    ie = mat->col_end[j];
+    for(; ix < ie;
+        ix++, value += matValueStep, rownr += matRowColStep) {
       absval = scaled_mat(lp, *value, *rownr, j);
       accumulate_for_scale(lp, &row_min[*rownr], &row_max[*rownr], absval);
     }
@@ -837,12 +841,12 @@ STATIC REAL scale(lprec *lp, REAL *scaledelta)
         accumulate_for_scale(lp, &col_min, &col_max, absval);
       }
 
-      i = mat->col_end[j - 1];
-      value = &(COL_MAT_VALUE(i));
-      rownr = &(COL_MAT_ROWNR(i));
-      nz = mat->col_end[j];
-      for(; i < nz;
-          i++, value += matValueStep, rownr += matRowColStep) {
+      ix = mat->col_end[j - 1];
+      value = &(COL_MAT_VALUE(ix));
+      rownr = &(COL_MAT_ROWNR(ix));
+      ie = mat->col_end[j];
+      for(; ix < ie;
+          ix++, value += matValueStep, rownr += matRowColStep) {
         absval = scaled_mat(lp, *value, *rownr, j);
         accumulate_for_scale(lp, &col_min, &col_max, absval);
       }
@@ -1000,6 +1004,7 @@ STATIC void unscale_columns(lprec *lp)
 
   /* Unscale mat */
   mat_validate(mat);
+  mat->vmap_cols = 0;
   nz = get_nonzeros(lp);
   value = &(COL_MAT_VALUE(0));
   rownr = &(COL_MAT_ROWNR(0));
@@ -1039,6 +1044,7 @@ void undoscale(lprec *lp)
 
     /* Unscale the matrix */
     mat_validate(mat);
+    mat->vmap_cols = 0;
     nz = get_nonzeros(lp);
     value = &(COL_MAT_VALUE(0));
     rownr = &(COL_MAT_ROWNR(0));
@@ -353,6 +353,7 @@ STATIC MYBOOL add_artificial(lprec *lp, int forrownr, REAL *nzarray, int *idxarr
 
   if(add) {
     int    *rownr = NULL, i, bvar, ii;
+    NZINDEX elmnr;
     REAL   *avalue = NULL, rhscoef, acoef;
     MATrec *mat = lp->matA;
 
@@ -370,9 +371,9 @@ STATIC MYBOOL add_artificial(lprec *lp, int forrownr, REAL *nzarray, int *idxarr
         ii = lp->var_basic[i] - lp->rows;
         if((ii <= 0) || (ii > (lp->columns-lp->P1extraDim)))
           continue;
-        ii = mat_findelm(mat, forrownr, ii);
-        if(ii >= 0) {
-          acoef = COL_MAT_VALUE(ii);
+        elmnr = mat_findelm(mat, forrownr, ii);
+        if(elmnr >= 0) {
+          acoef = COL_MAT_VALUE(elmnr);
           break;
         }
       }
@@ -458,9 +459,7 @@ STATIC int get_artificialRow(lprec *lp, int colnr)
 #endif
 
   /* Return the row index of the singleton */
-  colnr = mat->col_end[colnr-1];
-  colnr = COL_MAT_ROWNR(colnr);
-  return( colnr );
+  return( COL_MAT_ROWNR(mat->col_end[colnr-1]) );
 }
 
 STATIC int findAnti_artificial(lprec *lp, int colnr)
@@ -1037,6 +1036,9 @@ STATIC int dualloop(lprec *lp, MYBOOL dualfeasible, int dualinfeasibles[], REAL
   longsteps = (MYBOOL) ((MIP_count(lp) > 0) && (lp->bb_level > 1));
 #elif 0
   longsteps = (MYBOOL) ((MIP_count(lp) > 0) && (lp->solutioncount >= 1));
+#elif defined UseLongDualBreakpoints
+  longsteps = (MYBOOL) (lp->obj_in_basis && !is_piv_mode(lp, PRICE_NOLONGSTEP) &&
+                        (lp->boundedvars >= LONGDUAL_MINBOUNDED*lp->sum));
 #else
   longsteps = FALSE;
 #endif
@@ -1047,7 +1049,11 @@ STATIC int dualloop(lprec *lp, MYBOOL dualfeasible, int dualinfeasibles[], REAL
   if(longsteps) {
     lp->longsteps = multi_create(lp, TRUE);
     ok = (lp->longsteps != NULL) &&
+#ifdef UseLongDualBreakpoints
+         multi_resize(lp->longsteps, MIN(lp->boundedvars+2, LONGDUAL_MAXSTEPS), 1, TRUE, TRUE);
+#else
          multi_resize(lp->longsteps, MIN(lp->boundedvars+2, 11), 1, TRUE, TRUE);
+#endif
     if(!ok)
       goto Finish;
 #ifdef UseLongStepPruning
@@ -1775,12 +1781,18 @@ STATIC int heuristics(lprec *lp, int mode)
 }
 
 STATIC int lag_solve(lprec *lp, REAL start_bound, int num_iter)
+/* Maximize the Lagrangean dual over the constraints in matL.  The multipliers
+   are moved from a stability center along an aggregate of the subgradients,
+   where the center only follows trial points that improve the dual bound.
+   The subgradients and modified costs are computed in a single sparse pass
+   over the columns of matL.  Values are handled in minimization form. */
 {
-  int    i, j, citer, nochange, oldpresolve;
-  MYBOOL LagFeas, AnyFeas, Converged, same_basis;
-  REAL   *OrigObj, *ModObj, *SubGrad, *BestFeasSol;
-  REAL   Zub, Zlb, Znow, Zprev, Zbest, rhsmod, hold;
-  REAL   Phi, StepSize = 0.0, SqrsumSubGrad;
+  int    i, j, citer, nochange, oldpresolve, nLrows = get_Lrows(lp);
+  NZINDEX k, ie;
+  MYBOOL LagFeas, AnyFeas, Converged;
+  REAL   *OrigObj, *ModObj, *SubGrad, *AggGrad, *LagCenter, *BestFeasSol;
+  REAL   Zub, Zlb, Znow, Zbest, hold, value, Phi, StepSize, SqrsumAggGrad;
+  MATrec *mat = lp->matL;
 
   /* Make sure we have something to work with */
   if(lp->spx_status != OPTIMAL) {
@@ -1791,7 +1803,9 @@ STATIC int lag_solve(lprec *lp, REAL start_bound, int num_iter)
   /* Allocate iteration arrays */
   if(!allocREAL(lp, &OrigObj, lp->columns + 1, FALSE) ||
      !allocREAL(lp, &ModObj,  lp->columns + 1, TRUE) ||
-     !allocREAL(lp, &SubGrad, get_Lrows(lp) + 1, TRUE) ||
+     !allocREAL(lp, &SubGrad, nLrows + 1, TRUE) ||
+     !allocREAL(lp, &AggGrad, nLrows + 1, TRUE) ||
+     !allocREAL(lp, &LagCenter, nLrows + 1, TRUE) ||
      !allocREAL(lp, &BestFeasSol, lp->sum + 1, TRUE)) {
     lp->lag_status = NOMEMORY;
      return( lp->lag_status );
@@ -1803,33 +1817,22 @@ STATIC int lag_solve(lprec *lp, REAL start_bound, int num_iter)
   lp->do_presolve = PRESOLVE_NONE;
   push_basis(lp, NULL, NULL, NULL);
 
-  /* Initialize variables (assume minimization problem in overall structure) */
-  Zlb      = lp->best_solution[0];
-  Zub      = start_bound;
-  Zbest    = Zub;
-  Znow     = Zlb;
-  Zprev    = lp->infinite;
-  rhsmod   = 0;
-
+  /* Initialize the bounds; Zlb is the best Lagrangean (dual) bound and Zub
+     the target, which is the best known feasible value, if any */
+  Zlb      = -lp->infinite;
+  Zbest    = my_chsign(is_maxim(lp), start_bound);
+  Zub      = Zbest;
   Phi      = DEF_LAGCONTRACT; /* In the range 0-2.0 to guarantee convergence */
-/*  Phi      = 0.15; */
   LagFeas  = FALSE;
   Converged= FALSE;
   AnyFeas  = FALSE;
   citer    = 0;
   nochange = 0;
 
-  /* Initialize reference and solution vectors; don't bother about the
-     original OF offset since we are maintaining an offset locally. */
-
-/* #define DirectOverrideOF */
-
+  /* The relaxed model has already been solved at the zero multipliers */
   get_row(lp, 0, OrigObj);
-#ifdef DirectOverrideOF
-  set_OF_override(lp, ModObj);
-#endif
   OrigObj[0] = get_rh(lp, 0);
-  for(i = 1 ; i <= get_Lrows(lp); i++)
+  for(i = 1 ; i <= nLrows; i++)
     lp->lambda[i] = 0;
 
   /* Iterate to convergence, failure or user-specified termination */
@@ -1837,120 +1840,116 @@ STATIC int lag_solve(lprec *lp, REAL start_bound, int num_iter)
 
     citer++;
 
-    /* Compute constraint feasibility gaps and associated sum of squares,
-       and determine feasibility over the Lagrangean constraints;
-       SubGrad is the subgradient, which here is identical to the slack. */
+    /* Compute the subgradient L*x-b and the Lagrangean value of the relaxed
+       solution, and determine feasibility over the Lagrangean constraints */
+    value = my_chsign(is_maxim(lp), OrigObj[0]);
+    for(i = 1; i <= nLrows; i++)
+      SubGrad[i] = -lp->lag_rhs[i];
+    for(j = 1; j <= lp->columns; j++) {
+      hold = lp->best_solution[lp->rows + j];
+      if(hold == 0)
+        continue;
+      value += my_chsign(is_maxim(lp), OrigObj[j]) * hold;
+      ie = mat->col_end[j];
+      for(k = mat->col_end[j-1]; k < ie; k++)
+        SubGrad[COL_MAT_ROWNR(k)] += COL_MAT_VALUE(k) * hold;
+    }
+    Znow = value;
     LagFeas = TRUE;
     Converged = TRUE;
-    SqrsumSubGrad = 0;
-    for(i = 1; i <= get_Lrows(lp); i++) {
-      hold = lp->lag_rhs[i];
-      for(j = 1; j <= lp->columns; j++)
-        hold -= mat_getitem(lp->matL, i, j) * lp->best_solution[lp->rows + j];
-      if(LagFeas) {
-        if(lp->lag_con_type[i] == EQ) {
-          if(fabs(hold) > lp->epsprimal)
-            LagFeas = FALSE;
-        }
-        else if(hold < -lp->epsprimal)
+    for(i = 1; i <= nLrows; i++) {
+      hold = SubGrad[i];
+      Znow += lp->lambda[i] * hold;
+      if(lp->lag_con_type[i] == EQ) {
+        if(fabs(hold) > lp->epsprimal)
           LagFeas = FALSE;
       }
-      /* Test for convergence and update */
-      if(Converged && (fabs(my_reldiff(hold , SubGrad[i])) > /* lp->lag_accept */ DEF_LAGACCEPT))
+      else if(hold > lp->epsprimal)
+        LagFeas = FALSE;
+      /* Complementary slackness makes the relaxed solution optimal */
+      if(fabs(lp->lambda[i] * hold) > lp->epsprimal)
         Converged = FALSE;
-      SubGrad[i] = hold;
-      SqrsumSubGrad += hold * hold;
     }
-    SqrsumSubGrad = sqrt(SqrsumSubGrad);
-#if 1
     Converged &= LagFeas;
-#endif
-    if(Converged)
-      break;
-
-    /* Modify step parameters and initialize ahead of next iteration */
-    Znow = lp->best_solution[0] - rhsmod;
-    if(Znow > Zub) {
-      /* Handle exceptional case where we overshoot */
-      Phi *= DEF_LAGCONTRACT;
-      StepSize *= (Zub-Zlb) / (Znow-Zlb);
-    }
-    else
-#define LagBasisContract
-#ifdef LagBasisContract
-/*      StepSize = Phi * (Zub - Znow) / SqrsumSubGrad; */
-      StepSize = Phi * (2-DEF_LAGCONTRACT) * (Zub - Znow) / SqrsumSubGrad;
-#else
-      StepSize = Phi * (Zub - Znow) / SqrsumSubGrad;
-#endif
-
-    /* Compute the new dual price vector (Lagrangean multipliers, lambda) */
-    for(i = 1; i <= get_Lrows(lp); i++) {
-      lp->lambda[i] += StepSize * SubGrad[i];
-      if((lp->lag_con_type[i] != EQ) && (lp->lambda[i] > 0)) {
-        /* Handle case where we overshoot and need to correct (see above) */
-        if(Znow < Zub)
-          lp->lambda[i] = 0;
-      }
-    }
-/*    normalizeVector(lp->lambda, get_Lrows(lp)); */
-
-    /* Save the current vector if it is better */
-    if(LagFeas && (Znow < Zbest)) {
 
-      /* Recompute the objective function value in terms of the original values */
+    /* Save the relaxed solution if it is feasible and better */
+    if(LagFeas && (value < Zbest)) {
       MEMCOPY(BestFeasSol, lp->best_solution, lp->sum+1);
-      hold = OrigObj[0];
-      for(i = 1; i <= lp->columns; i++)
-        hold += lp->best_solution[lp->rows + i] * OrigObj[i];
-      BestFeasSol[0] = hold;
+      BestFeasSol[0] = my_chsign(is_maxim(lp), value);
       if(lp->lag_trace)
         report(lp, NORMAL, "lag_solve: Improved feasible solution at iteration %d of %g\n",
-                           citer, hold);
+                           citer, BestFeasSol[0]);
+      Zbest = value;
+      Zub   = value;
+      AnyFeas = TRUE;
+    }
 
-      /* Reset variables */
-      Zbest = Znow;
-      AnyFeas  = TRUE;
+    /* Move the stability center if the dual bound improved, otherwise
+       contract the step after repeated non-improving trial points */
+    if(Znow > Zlb) {
+      for(i = 1; i <= nLrows; i++)
+        LagCenter[i] = lp->lambda[i];
+      Zlb = Znow;
       nochange = 0;
     }
-    else if(Znow == Zprev) {
-      nochange++;
-      if(nochange > LAG_SINGULARLIMIT) {
-        Phi *= 0.5;
-        nochange = 0;
-      }
+    else if(++nochange > LAG_SINGULARLIMIT) {
+      Phi *= 0.5;
+      nochange = 0;
+    }
+
+    /* Update the aggregate subgradient */
+    SqrsumAggGrad = 0;
+    for(i = 1; i <= nLrows; i++) {
+      if(citer == 1)
+        AggGrad[i] = SubGrad[i];
+      else
+        AggGrad[i] += DEF_LAGAGGREGATE * (SubGrad[i] - AggGrad[i]);
+      SqrsumAggGrad += AggGrad[i] * AggGrad[i];
+    }
+
+    /* Test for convergence on the duality gap and the step size */
+    if(!Converged && AnyFeas)
+      Converged = (MYBOOL) (Zub - Zlb <= DEF_LAGACCEPT * (1 + fabs(Zlb)));
+    if(Converged || (SqrsumAggGrad < lp->epsprimal) || (Phi < DEF_LAGACCEPT))
+      break;
+
+    /* Compute the step toward the target; without a feasible value the
+       target is a relative improvement of the current dual bound */
+    if(my_infinite(lp, Zub))
+      hold = DEF_LAGTARGETGAP * MAX(1, fabs(Zlb));
+    else
+      hold = Zub - Zlb;
+    StepSize = Phi * hold / SqrsumAggGrad;
+
+    /* Compute the new multipliers from the stability center */
+    for(i = 1; i <= nLrows; i++) {
+      lp->lambda[i] = LagCenter[i] + StepSize * AggGrad[i];
+      if((lp->lag_con_type[i] != EQ) && (lp->lambda[i] < 0))
+        lp->lambda[i] = 0;
     }
-    Zprev = Znow;
 
     /* Recompute the objective function values for the next iteration */
     for(j = 1; j <= lp->columns; j++) {
       hold = 0;
-      for(i = 1; i <= get_Lrows(lp); i++)
-        hold += lp->lambda[i] * mat_getitem(lp->matL, i, j);
-      ModObj[j] = OrigObj[j] - my_chsign(is_maxim(lp), hold);
-#ifndef DirectOverrideOF
+      ie = mat->col_end[j];
+      for(k = mat->col_end[j-1]; k < ie; k++)
+        hold += lp->lambda[COL_MAT_ROWNR(k)] * COL_MAT_VALUE(k);
+      ModObj[j] = OrigObj[j] + my_chsign(is_maxim(lp), hold);
       set_mat(lp, 0, j, ModObj[j]);
-#endif
     }
 
-    /* Recompute the fixed part of the new objective function */
-    rhsmod = my_chsign(is_maxim(lp), get_rh(lp, 0));
-    for(i = 1; i <= get_Lrows(lp); i++)
-      rhsmod += lp->lambda[i] * lp->lag_rhs[i];
-
     /* Print trace/debugging information, if specified */
     if(lp->lag_trace) {
       report(lp, IMPORTANT, "Zub: %10g Zlb: %10g Stepsize: %10g Phi: %10g Feas %d\n",
                  (double) Zub, (double) Zlb, (double) StepSize, (double) Phi, LagFeas);
-      for(i = 1; i <= get_Lrows(lp); i++)
+      for(i = 1; i <= nLrows; i++)
         report(lp, IMPORTANT, "%3d SubGrad %10g lambda %10g\n",
                    i, (double) SubGrad[i], (double) lp->lambda[i]);
       if(lp->sum < 20)
         print_lp(lp);
     }
 
-    /* Solve the Lagrangean relaxation, handle failures and compute
-       the Lagrangean objective value, if successful */
+    /* Solve the Lagrangean relaxation and handle failures */
     i = spx_solve(lp);
     if(lp->spx_status == UNBOUNDED) {
       if(lp->lag_trace) {
@@ -1965,47 +1964,35 @@ STATIC int lag_solve(lprec *lp, REAL start_bound, int num_iter)
             (lp->spx_status == INFEASIBLE)) {
       lp->lag_status = lp->spx_status;
     }
-
-    /* Compare optimal bases and contract if we have basis stationarity */
-#ifdef LagBasisContract
-    same_basis = compare_basis(lp);
-    if(LagFeas &&
-       !same_basis) {
-      pop_basis(lp, FALSE);
-      push_basis(lp, NULL, NULL, NULL);
-      Phi *= DEF_LAGCONTRACT;
-    }
-    if(lp->lag_trace) {
-      report(lp, DETAILED, "lag_solve: Simplex status code %d, same basis %s\n",
-                 lp->spx_status, my_boolstr(same_basis));
-      print_solution(lp, 1);
-    }
-#endif
+    else if(lp->lag_trace)
+      report(lp, DETAILED, "lag_solve: Simplex status code %d\n", lp->spx_status);
   }
 
+  /* Report the multipliers at the stability center in the user sign */
+  for(i = 1; i <= nLrows; i++)
+    lp->lambda[i] = my_chsign(is_maxim(lp), LagCenter[i]);
+
   /* Transfer solution values */
   if(AnyFeas) {
-    /*lp->lag_bound = my_chsign(is_maxim(lp), Zbest);*/
     for(i = 0; i <= lp->sum; i++)
       lp->solution[i] = BestFeasSol[i];
     transfer_solution(lp, TRUE);
-    if(!is_maxim(lp))
-      for(i = 1; i <= get_Lrows(lp); i++)
-        lp->lambda[i] = my_flipsign(lp->lambda[i]);
   }
 
   /* Do standard postprocessing */
 Leave:
 
   /* Set status variables and report */
-  if(citer >= num_iter) {
-    if(AnyFeas)
+  if(lp->lag_status == RUNNING) {
+    if(Converged)
+      lp->lag_status = OPTIMAL;
+    else if(lp->spx_status == UNBOUNDED)
+      lp->lag_status = UNBOUNDED;
+    else if(AnyFeas)
       lp->lag_status = FEASFOUND;
     else
       lp->lag_status = NOFEASFOUND;
   }
-  else
-    lp->lag_status = lp->spx_status;
   if(lp->lag_status == OPTIMAL) {
     report(lp, NORMAL, "\nLagrangean convergence achieved in %d iterations\n",  citer);
     i = check_solution(lp, lp->columns,
@@ -2018,17 +2005,18 @@ Leave:
       report(lp, NORMAL, "The best feasible Lagrangean objective function value was %g\n",
                          lp->best_solution[0]);
   }
+  if(!my_infinite(lp, Zlb))
+    report(lp, NORMAL, "The best Lagrangean bound on the objective function value was %g\n",
+                       (double) my_chsign(is_maxim(lp), Zlb));
 
   /* Restore the original objective function */
-#ifdef DirectOverrideOF
-  set_OF_override(lp, NULL);
-#else
   for(i = 1; i <= lp->columns; i++)
     set_mat(lp, 0, i, OrigObj[i]);
-#endif
 
   /* ... and then free memory */
   FREE(BestFeasSol);
+  FREE(LagCenter);
+  FREE(AggGrad);
   FREE(SubGrad);
   FREE(OrigObj);
   FREE(ModObj);
@@ -2047,6 +2035,7 @@ STATIC int spx_solve(lprec *lp)
   lp->total_iter       = 0;
   lp->total_bswap      = 0;
   lp->perturb_count    = 0;
+  lp->refine_count     = 0;
   lp->bb_maxlevel      = 1;
   lp->bb_totalnodes    = 0;
   lp->bb_improvements  = 0;
@@ -2077,10 +2066,16 @@ STATIC int spx_solve(lprec *lp)
     lp->real_solution = lp->infinite;
     set_action(&lp->spx_action, ACTION_REBASE | ACTION_REINVERT);
     lp->bb_break = FALSE;
+    invalidatePricer(lp);
+
+    /* Pack the matrix values for the product kernels if so requested */
+    if(lp->memory_policy & MEMORY_VALUEMAP)
+      mat_vmapbuild(lp->matA);
 
     /* Do the call to the real underlying solver (note that
        run_BB is replaceable with any compatible MIP solver) */
     status = run_BB(lp);
+    mat_vmapfree(lp->matA);
 
     /* Restore modified problem */
     if(iprocessed)
@@ -2126,6 +2121,9 @@ Leave:
     if(lp->perturb_count > 0)
       report(lp, NORMAL, "      The bounds were relaxed via perturbations %d times.\n",
                           lp->perturb_count);
+    if(lp->refine_count > 0)
+      report(lp, NORMAL, "      Iterative refinement of FTRAN/BTRAN solves took %d steps.\n",
+                          lp->refine_count);
     if(MIP_count(lp) > 0) {
       if(lp->bb_solutionlevel > 0)
         report(lp, NORMAL, "      The maximum B&B level was %d, %.1fx MIP order, %d at the optimal solution.\n",
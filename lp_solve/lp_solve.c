@@ -102,6 +102,7 @@ void print_help(char *argv[])
 	printf("-pivla\t\tScan entering/leaving columns alternatingly left/right.\n");
 	printf("-pivh\t\tUse Harris' primal pivot logic rather than the default.\n");
 	printf("-pivt\t\tUse true norms for Devex and Steepest Edge initializations.\n");
+	printf("-pivnl\t\tDisable the long-step dual ratio test on models with many bounded variables.\n");
 	printf("-o0\t\tDon't put objective in basis%s.\n", DEF_OBJINBASIS ? "" : " (default)");
 	printf("-o1\t\tPut objective in basis%s.\n", DEF_OBJINBASIS ? " (default)" : "");
 	printf("-s <mode> <scaleloop>\tuse automatic problem scaling.\n");
@@ -146,6 +147,11 @@ void print_help(char *argv[])
 	printf("\t -C0: No crash basis\n");
 	printf("\t -C2: Most feasible basis\n");
 	printf("\t -C3: Least degenerate basis\n");
+	printf("\t -C4: Sifting basis for models with many more columns than rows\n");
+	printf("\t -C5: Decomposition basis for block-angular models\n");
+	printf("\t -C6: Network simplex basis for pure network models\n");
+	printf("\t -C7: Bixby's triangular crash basis\n");
+	printf("\t -C8: Lower triangular sparse-first (LTSF) crash basis\n");
 	printf("-prim\t\tPrefer the primal simplex for both phases.\n");
 	printf("-dual\t\tPrefer the dual simplex for both phases.\n");
 	printf("-simplexpp\tSet Phase1 Primal, Phase2 Primal.\n");
@@ -163,6 +169,8 @@ void print_help(char *argv[])
 	printf("-degenb\t\tanti-degen B&B\n");
 	printf("-degenr\t\tanti-degen Perturbation of the working RHS at refactorization\n");
 	printf("-degenp\t\tanti-degen Limit bound flips\n");
+	printf("-degeno\t\tanti-degen Perturbation of the costs at start, removed at optimality\n");
+	printf("-degenh\t\tanti-degen Shift of the variable bounds at start, removed at optimality\n");
 	printf("-trej <Trej>\tset minimum pivot value\n");
 	printf("-epsd <epsd>\tset minimum tolerance for reduced costs\n");
 	printf("-epsb <epsb>\tset minimum tolerance for the RHS\n");
@@ -174,6 +182,13 @@ void print_help(char *argv[])
 	printf("\t -improve2: Improve initial dual feasibility by bound flips (default)\n");
 	printf("\t -improve4: Low-cost accuracy monitoring in the dual\n");
 	printf("\t -improve8: check for primal/dual feasibility at the node level\n");
+	printf("\t -improve16: Iterative refinement of FTRAN/BTRAN solves with compensated residuals\n");
+	printf("-mem <level>\tmemory allocation policy for the solver vectors\n");
+	printf("\t -mem0: plain allocation (default)\n");
+	printf("\t -mem1: 64-byte aligned vectors\n");
+	printf("\t -mem2: aligned vectors, with transparent huge pages for large ones\n");
+	printf("\t -mem4: index the matrix values by a table of distinct values while solving\n");
+	printf("\t -mem8: find elements in long matrix columns through a coordinate hash\n");
 	printf("-timeout <sec>\tTimeout after sec seconds when not solution found.\n");
 	printf("-ac <accuracy>\tFail when accuracy is less then specified value.\n");
 	/*
@@ -219,7 +234,10 @@ void print_help(char *argv[])
 	printf("-BB\t\tBreadthFirst branch-and-bound\n");
 	printf("-Bo\t\tOrder variables to improve branch-and-bound performance\n");
 	printf("-Bc\t\tDo bound tightening during B&B based of reduced cost info\n");
+	printf("-BC\t\tAlso tighten bounds globally from the root reduced costs on each improved solution\n");
 	printf("-Bi\t\tInitialize pseudo-costs by strong branching\n");
+	printf("-Bn\t\tPropagate bound changes through the constraints at each B&B node\n");
+	printf("-Bl\t\tLearn conflicts from infeasible B&B nodes and check them at later nodes (implies -Bn)\n");
 	printf("\n");
 	printf("-time\t\tPrint CPU time to parse input and to calculate result.\n");
 	printf("-v <level>\tverbose mode, gives flow through the program.\n");
@@ -927,6 +945,7 @@ int main(int argc, char *argv[])
 	short objective = 0;
 	short PRINT_SOLUTION = 2;
 	int improve = -1;
+	int memory_policy = -1;
 	int pivoting1 = -1;
 	int pivoting2 = -1;
 	int bb_rule1 = -1;
@@ -1069,8 +1088,14 @@ int main(int argc, char *argv[])
 			or_value(&bb_rule2, NODE_AUTOORDER);
 		else if (strcmp(argv[i], "-Bc") == 0)
 			or_value(&bb_rule2, NODE_RCOSTFIXING);
+		else if (strcmp(argv[i], "-BC") == 0)
+			or_value(&bb_rule2, NODE_RCOSTGLOBAL);
 		else if (strcmp(argv[i], "-Bi") == 0)
 			or_value(&bb_rule2, NODE_STRONGINIT);
+		else if (strcmp(argv[i], "-Bn") == 0)
+			or_value(&bb_rule2, NODE_PROPAGATE);
+		else if (strcmp(argv[i], "-Bl") == 0)
+			or_value(&bb_rule2, NODE_CONFLICTS);
 		else if (strncmp(argv[i], "-B", 2) == 0) {
 			if (argv[i][2])
 				set_value(&bb_rule1, atoi(argv[i] + 2));
@@ -1191,6 +1216,10 @@ int main(int argc, char *argv[])
 			if (argv[i][8])
 				or_value(&improve, atoi(argv[i] + 8));
 		}
+		else if (strncmp(argv[i], "-mem", 4) == 0) {
+			if (argv[i][4])
+				or_value(&memory_policy, atoi(argv[i] + 4));
+		}
 		else if (strcmp(argv[i], "-pivll") == 0)
 			or_value(&pivoting2, PRICE_LOOPLEFT);
 		else if (strcmp(argv[i], "-pivla") == 0)
@@ -1215,6 +1244,8 @@ int main(int argc, char *argv[])
 			or_value(&pivoting2, PRICE_HARRISTWOPASS);
 		else if (strcmp(argv[i], "-pivt") == 0)
 			or_value(&pivoting2, PRICE_TRUENORMINIT);
+		else if (strcmp(argv[i], "-pivnl") == 0)
+			or_value(&pivoting2, PRICE_NOLONGSTEP);
 		else if (strncmp(argv[i], "-piv", 4) == 0) {
 			if (argv[i][4])
 				set_value(&pivoting1, atoi(argv[i] + 4));
@@ -1269,6 +1300,10 @@ int main(int argc, char *argv[])
 			or_value(&anti_degen2, ANTIDEGEN_RHSPERTURB);
 		else if (strcmp(argv[i], "-degenp") == 0)
 			or_value(&anti_degen2, ANTIDEGEN_BOUNDFLIP);
+		else if (strcmp(argv[i], "-degeno") == 0)
+			or_value(&anti_degen2, ANTIDEGEN_COSTPERTURB);
+		else if (strcmp(argv[i], "-degenh") == 0)
+			or_value(&anti_degen2, ANTIDEGEN_BOUNDSHIFT);
 		else if (strcmp(argv[i], "-time") == 0) {
 			if (clock() == -1)
 				fprintf(stderr, "CPU times not available on this machine\n");
@@ -1563,6 +1598,8 @@ int main(int argc, char *argv[])
 	set_presolve(lp, ((do_presolve == -1) ? get_presolve(lp) : do_presolve) | ((PRINT_SOLUTION >= 4) ? PRESOLVE_SENSDUALS : 0), get_presolveloops(lp));
 	if (improve != -1)
 		set_improve(lp, improve);
+	if (memory_policy != -1)
+		set_memory_policy(lp, memory_policy);
 	if (max_num_inv >= 0)
 		set_maxpivot(lp, max_num_inv);
 	if (preferdual != AUTOMATIC)
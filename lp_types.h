@@ -21,12 +21,22 @@
   #define COUNTER LLONG
 #endif
 
+#ifndef NZINDEX
+  #ifdef NZINDEX64
+    #define NZINDEX LLONG       /* 64-bit non-zero positions for over 2^31 elements */
+  #else
+    #define NZINDEX int         /* Position type of non-zeros in sparse matrix storage */
+  #endif
+#endif
+
 #ifndef REAL
   #define REAL    double
 #endif
 
 #ifndef REALXP
-  #if 1
+  #if defined REALXP_COMPENSATED
+    #define REALXP REAL          /* Compensated accumulation in default precision, see my_xpaddprod */
+  #elif 1
     #define REALXP long double  /* Set local accumulation variable as long double */
   #else
     #define REALXP REAL          /* Set local accumulation as default precision */
@@ -208,6 +218,26 @@
 #define my_roundzero(val, eps)  if (fabs((REAL) (val)) < eps) val = 0
 #define my_avoidtiny(val, eps)  (fabs((REAL) (val)) < eps ? 0 : val)
 
+/* Inner product accumulation; with REALXP_COMPENSATED the sum carries a running
+   TwoSum error term that my_xpfinish folds back in (the product error is also
+   captured exactly if REALXP_FMA is defined); do not combine with -ffast-math */
+#ifdef REALXP_COMPENSATED
+  #define my_xpinit(s, c, x)    { (s) = (x); (c) = 0; }
+  #ifdef REALXP_FMA
+    #define my_xpaddprod(s, c, x, y) { REAL xp_p = (REAL) (x)*(y), xp_e = fma((REAL) (x), (REAL) (y), -xp_p), \
+                                          xp_t = (s) + xp_p, xp_z = xp_t - (s); \
+                                     (c) += ((s) - (xp_t - xp_z)) + (xp_p - xp_z) + xp_e; (s) = xp_t; }
+  #else
+    #define my_xpaddprod(s, c, x, y) { REAL xp_p = (REAL) (x)*(y), xp_t = (s) + xp_p, xp_z = xp_t - (s); \
+                                     (c) += ((s) - (xp_t - xp_z)) + (xp_p - xp_z); (s) = xp_t; }
+  #endif
+  #define my_xpfinish(s, c)     (s) += (c)
+#else
+  #define my_xpinit(s, c, x)    (s) = (x)
+  #define my_xpaddprod(s, c, x, y) (s) += (x)*(y)
+  #define my_xpfinish(s, c)
+#endif
+
 #if 1
   #define my_infinite(lp, val)  ( (MYBOOL) (fabs(val) >= lp->infinite) )
 #else
@@ -29,10 +29,31 @@
     v1.2.0  10 January 2005     Added vector pushing/popping functionality
                                 Modified return values and fixed problem in
                                 linked list functions.
+    v1.3.0  17 October 2026     Replaced the sorted work array list by size class
+                                free lists with chunk-based allocation.
+    v1.3.1  17 October 2026     Added aligned and huge page allocation policies.
+    v1.3.2  17 October 2026     Work array chunks and single blocks also follow
+                                the allocation policy.
 
    ----------------------------------------------------------------------------------
 */
 
+/* Allocate according to the memory policy of the model; clear has the same meaning
+   as for the allocation routines below */
+STATIC void *allocPOLICY(lprec *lp, void *ptr, size_t size, MYBOOL clear)
+{
+  size_t hugesize = 0;
+
+  if(lp->memory_policy & MEMORY_HUGEPAGES)
+    hugesize = DEF_HUGEPAGELIMIT;
+  if(!(clear & AUTOMATIC))
+    ptr = NULL;
+  ptr = realloc_aligned(ptr, size, DEF_MEMORYALIGN, hugesize);
+  if((ptr != NULL) && (clear & TRUE))
+    memset(ptr, 0, size);
+  return( ptr );
+}
+
 STATIC MYBOOL allocCHAR(lprec *lp, char **ptr, int size, MYBOOL clear)
 {
   if(clear == TRUE)
@@ -71,9 +92,11 @@ STATIC MYBOOL allocMYBOOL(lprec *lp, MYBOOL **ptr, int size, MYBOOL clear)
   else
     return( TRUE );
 }
-STATIC MYBOOL allocINT(lprec *lp, int **ptr, int size, MYBOOL clear)
+STATIC MYBOOL allocINT(lprec *lp, int **ptr, NZINDEX size, MYBOOL clear)
 {
-  if(clear == TRUE)
+  if((lp != NULL) && (lp->memory_policy & MEMORY_ALLOCMASK))
+    *ptr = (int *) allocPOLICY(lp, *ptr, (size_t) size * sizeof(**ptr), clear);
+  else if(clear == TRUE)
     *ptr = (int *) calloc(size, sizeof(**ptr));
   else if(clear & AUTOMATIC) {
     *ptr = (int *) realloc(*ptr, size * sizeof(**ptr));
@@ -83,16 +106,18 @@ STATIC MYBOOL allocINT(lprec *lp, int **ptr, int size, MYBOOL clear)
   else
     *ptr = (int *) malloc(size * sizeof(**ptr));
   if(((*ptr) == NULL) && (size > 0)) {
-    lp->report(lp, CRITICAL, "alloc of %d 'INT' failed\n", size);
+    lp->report(lp, CRITICAL, "alloc of %.0f 'INT' failed\n", (double) size);
     lp->spx_status = NOMEMORY;
     return( FALSE );
   }
   else
     return( TRUE );
 }
-STATIC MYBOOL allocREAL(lprec *lp, REAL **ptr, int size, MYBOOL clear)
+STATIC MYBOOL allocREAL(lprec *lp, REAL **ptr, NZINDEX size, MYBOOL clear)
 {
-  if(clear == TRUE)
+  if((lp != NULL) && (lp->memory_policy & MEMORY_ALLOCMASK))
+    *ptr = (REAL *) allocPOLICY(lp, *ptr, (size_t) size * sizeof(**ptr), clear);
+  else if(clear == TRUE)
     *ptr = (REAL *) calloc(size, sizeof(**ptr));
   else if(clear & AUTOMATIC) {
     *ptr = (REAL *) realloc(*ptr, size * sizeof(**ptr));
@@ -102,16 +127,41 @@ STATIC MYBOOL allocREAL(lprec *lp, REAL **ptr, int size, MYBOOL clear)
   else
     *ptr = (REAL *) malloc(size * sizeof(**ptr));
   if(((*ptr) == NULL) && (size > 0)) {
-    lp->report(lp, CRITICAL, "alloc of %d 'REAL' failed\n", size);
+    lp->report(lp, CRITICAL, "alloc of %.0f 'REAL' failed\n", (double) size);
+    lp->spx_status = NOMEMORY;
+    return( FALSE );
+  }
+  else
+    return( TRUE );
+}
+#ifdef NZINDEX64
+STATIC MYBOOL allocNZINDEX(lprec *lp, NZINDEX **ptr, NZINDEX size, MYBOOL clear)
+{
+  if((lp != NULL) && (lp->memory_policy & MEMORY_ALLOCMASK))
+    *ptr = (NZINDEX *) allocPOLICY(lp, *ptr, (size_t) size * sizeof(**ptr), clear);
+  else if(clear == TRUE)
+    *ptr = (NZINDEX *) calloc(size, sizeof(**ptr));
+  else if(clear & AUTOMATIC) {
+    *ptr = (NZINDEX *) realloc(*ptr, size * sizeof(**ptr));
+    if(clear & TRUE)
+      MEMCLEAR(*ptr, size);
+  }
+  else
+    *ptr = (NZINDEX *) malloc(size * sizeof(**ptr));
+  if(((*ptr) == NULL) && (size > 0)) {
+    lp->report(lp, CRITICAL, "alloc of %.0f 'NZINDEX' failed\n", (double) size);
     lp->spx_status = NOMEMORY;
     return( FALSE );
   }
   else
     return( TRUE );
 }
+#endif
 STATIC MYBOOL allocLREAL(lprec *lp, LREAL **ptr, int size, MYBOOL clear)
 {
-  if(clear == TRUE)
+  if((lp != NULL) && (lp->memory_policy & MEMORY_ALLOCMASK))
+    *ptr = (LREAL *) allocPOLICY(lp, *ptr, (size_t) size * sizeof(**ptr), clear);
+  else if(clear == TRUE)
     *ptr = (LREAL *) calloc(size, sizeof(**ptr));
   else if(clear & AUTOMATIC) {
     *ptr = (LREAL *) realloc(*ptr, size * sizeof(**ptr));
@@ -205,6 +255,21 @@ int comp_bits(MYBOOL *bitarray1, MYBOOL *bitarray2, int items)
 }
 
 
+/* Size of the block header, rounded up to DEF_MEMORYALIGN so that the vectors keep
+   the alignment of the chunks and single blocks under MEMORY_ALIGNED */
+#define MEMPOOL_HEADERSIZE  (((int) sizeof(memblockrec) + DEF_MEMORYALIGN-1) / DEF_MEMORYALIGN * DEF_MEMORYALIGN)
+
+/* Allocate a cleared chunk or single block according to the memory policy */
+STATIC void *mempool_allocBlock(workarraysrec *mempool, size_t size)
+{
+  lprec *lp = mempool->lp;
+
+  if(lp->memory_policy & MEMORY_ALLOCMASK)
+    return( allocPOLICY(lp, NULL, size, TRUE) );
+  else
+    return( calloc(size, 1) );
+}
+
 STATIC workarraysrec *mempool_create(lprec *lp)
 {
   workarraysrec *temp;
@@ -212,130 +277,120 @@ STATIC workarraysrec *mempool_create(lprec *lp)
   temp->lp = lp;
   return( temp );
 }
+/* Obtain a vector of at least count items of unitsize bytes; the contents of a
+   recycled vector are undefined, while newly carved memory is zero */
 STATIC char *mempool_obtainVector(workarraysrec *mempool, int count, int unitsize)
 {
-  char   *newmem = NULL;
-  MYBOOL *bnewmem = NULL;
-  int    *inewmem = NULL, size, i, ib, ie, memMargin = 0;
-  REAL   *rnewmem = NULL;
-
-  /* First find the iso-sized window (binary search) */
-  size = count*unitsize;
-  memMargin += size;
-  ib = 0;
-  ie = mempool->count-1;
-  while(ie >= ib) {
-    i = (ib+ie) / 2;
-    if(abs(mempool->vectorsize[i]) > memMargin)
-      ie = i-1;
-    else if(abs(mempool->vectorsize[i]) < size)
-      ib = i+1;
-    else {
-      /* Find the beginning of the exact-sized array group */
-      do {
-        ib = i;
-        i--;
-      } while((i >= 0) && (abs(mempool->vectorsize[i]) >= size));
-      break;
-    }
+  memblockrec *block;
+  int         sizeclass;
+  size_t      size, blocksize;
+
+  /* Find the size class; a request beyond the largest class gets an oversize
+     block of its exact size, which is not recycled */
+  if((count < 0) || (unitsize < 0))
+    goto Failed;
+  size = (size_t) count * (size_t) unitsize;
+  sizeclass = MEMPOOL_MINCLASS;
+  while((sizeclass < MEMPOOL_MINCLASS+MEMPOOL_CLASSES-1) && (((size_t) 1 << sizeclass) < size))
+    sizeclass++;
+  if(((size_t) 1 << sizeclass) < size) {
+    if(size > (size_t) -1 - (size_t) MEMPOOL_HEADERSIZE)
+      goto Failed;
+    sizeclass = MEMPOOL_CLASSES;
   }
-
-  /* Check if we have a preallocated unused array of sufficient size */
-  ie = mempool->count-1;
-  for(i = ib; i <= ie; i++)
-    if(mempool->vectorsize[i] < 0)
-      break;
-
-  /* Obtain and activate existing, unused vector if we are permitted */
-  if(i <= ie) {
-#ifdef Paranoia
-    if((mempool->vectorsize[i] > 0) || (abs(mempool->vectorsize[i]) < size)) {
-      lprec *lp = mempool->lp;
-      lp->report(lp, SEVERE, "mempool_obtainVector: Invalid %s existing vector selected\n",
-                             (ie < 0 ? "too small" : "occupied"));
-      lp->spx_status = NOMEMORY;
-      lp->bb_break = TRUE;
-      return( newmem );
-    }
-#endif
-    newmem = mempool->vectorarray[i];
-    mempool->vectorsize[i] *= -1;
-  }
-
-  /* Otherwise allocate a new vector */
-  else if(unitsize == sizeof(MYBOOL)) {
-    allocMYBOOL(mempool->lp, &bnewmem, count, TRUE);
-    newmem = (char *) bnewmem;
-  }
-  else if(unitsize == sizeof(int)) {
-    allocINT(mempool->lp, &inewmem, count, TRUE);
-    newmem = (char *) inewmem;
-  }
-  else if(unitsize == sizeof(REAL)) {
-    allocREAL(mempool->lp, &rnewmem, count, TRUE);
-    newmem = (char *) rnewmem;
+  else {
+    size = (size_t) 1 << sizeclass;
+    sizeclass -= MEMPOOL_MINCLASS;
   }
-
-  /* Insert into master array if necessary (maintain sort by ascending size) */
-  if((i > ie) && (newmem != NULL)) {
-    mempool->count++;
-    if(mempool->count >= mempool->size) {
-      mempool->size += 10;
-      mempool->vectorarray = (char **) realloc(mempool->vectorarray,
-                                     sizeof(*(mempool->vectorarray))*mempool->size);
-      mempool->vectorsize  = (int *) realloc(mempool->vectorsize,
-                                     sizeof(*(mempool->vectorsize))*mempool->size);
+  blocksize = (size_t) MEMPOOL_HEADERSIZE + size;
+
+  /* Take a block from the free list, else carve it from the current chunk,
+     starting a new chunk if needed; large blocks are allocated singly */
+  block = (sizeclass < MEMPOOL_CLASSES ? mempool->freelist[sizeclass] : NULL);
+  if(block != NULL)
+    mempool->freelist[sizeclass] = block->next;
+  else if(blocksize <= MEMPOOL_CHUNKSIZE / 4) {
+    if((mempool->chunk == NULL) || (mempool->chunkused + blocksize > MEMPOOL_CHUNKSIZE)) {
+      char *newchunk = (char *) mempool_allocBlock(mempool, MEMPOOL_CHUNKSIZE);
+      if(newchunk == NULL)
+        goto Failed;
+      *((char **) newchunk) = mempool->chunk;
+      mempool->chunk = newchunk;
+      mempool->chunkused = MEMPOOL_HEADERSIZE;
+      mempool->bytesreserved += MEMPOOL_CHUNKSIZE;
     }
-    ie++;
-    i = ie + 1;
-    if(i < mempool->count) {
-      MEMMOVE(mempool->vectorarray+i, mempool->vectorarray+ie, 1);
-      MEMMOVE(mempool->vectorsize+i,  mempool->vectorsize+ie,  1);
-    }
-    mempool->vectorarray[ie] = newmem;
-    mempool->vectorsize[ie]  = size;
+    block = (memblockrec *) (mempool->chunk + mempool->chunkused);
+    mempool->chunkused += (int) blocksize;
+    block->size      = size;
+    block->sizeclass = sizeclass;
+  }
+  else {
+    block = (memblockrec *) mempool_allocBlock(mempool, blocksize);
+    if(block == NULL)
+      goto Failed;
+    block->size      = size;
+    block->sizeclass = sizeclass;
+    block->chain = mempool->largelist;
+    mempool->largelist = block;
+    mempool->bytesreserved += (COUNTER) blocksize;
   }
 
-  return( newmem );
+  /* Activate and update the statistics */
+  block->next  = NULL;
+  block->inuse = TRUE;
+  mempool->obtained++;
+  mempool->bytesinuse += (COUNTER) size;
+  SETMAX(mempool->bytespeak, mempool->bytesinuse);
+  return( (char *) block + MEMPOOL_HEADERSIZE );
+
+Failed:
+  mempool->lp->report(mempool->lp, CRITICAL, "mempool_obtainVector: alloc of %d items of %d bytes failed\n",
+                                             count, unitsize);
+  mempool->lp->spx_status = NOMEMORY;
+  return( NULL );
 }
+/* Return a vector to the free list of its size class; memory is only given back
+   to the system by mempool_free, except for oversize blocks that are freed at once,
+   so forcefree is accepted for compatibility */
 STATIC MYBOOL mempool_releaseVector(workarraysrec *mempool, char *memvector, MYBOOL forcefree)
 {
-  int i;
-
-#if 0
-  forcefree = TRUE;
-#endif
-
-  for(i = mempool->count-1; i >= 0; i--)
-    if(mempool->vectorarray[i] == memvector)
-      break;
+  memblockrec *block, **link;
 
-  if((i < 0) || (mempool->vectorsize[i] < 0))
+  if(memvector == NULL)
+    return( FALSE );
+  block = (memblockrec *) (memvector - MEMPOOL_HEADERSIZE);
+  if(!block->inuse)
     return( FALSE );
 
-  if(forcefree) {
-    FREE(mempool->vectorarray[i]);
-    mempool->count--;
-    for(; i < mempool->count; i++)
-      mempool->vectorarray[i] = mempool->vectorarray[i+1];
+  block->inuse = FALSE;
+  mempool->bytesinuse -= (COUNTER) block->size;
+  if(block->sizeclass == MEMPOOL_CLASSES) {
+    for(link = &mempool->largelist; *link != block; link = &(*link)->chain);
+    *link = block->chain;
+    mempool->bytesreserved -= (COUNTER) (MEMPOOL_HEADERSIZE + block->size);
+    free(block);
+  }
+  else {
+    block->next = mempool->freelist[block->sizeclass];
+    mempool->freelist[block->sizeclass] = block;
   }
-  else
-    mempool->vectorsize[i] *= -1;
-
   return( TRUE );
 }
 STATIC MYBOOL mempool_free(workarraysrec **mempool)
 {
-  int i = (*mempool)->count;
+  char        *chunk;
+  memblockrec *block;
 
-  while(i > 0) {
-    i--;
-    if((*mempool)->vectorsize[i] < 0)  /* Handle unused vectors */
-      (*mempool)->vectorsize[i] *= -1;
-    mempool_releaseVector(*mempool, (*mempool)->vectorarray[i], TRUE);
+  while((*mempool)->chunk != NULL) {
+    chunk = (*mempool)->chunk;
+    (*mempool)->chunk = *((char **) chunk);
+    free(chunk);
+  }
+  while((*mempool)->largelist != NULL) {
+    block = (*mempool)->largelist;
+    (*mempool)->largelist = block->chain;
+    free(block);
   }
-  FREE((*mempool)->vectorarray);
-  FREE((*mempool)->vectorsize);
   FREE(*mempool);
   return( TRUE );
 }
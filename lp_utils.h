@@ -15,14 +15,34 @@
 
 #include "lp_types.h"
 
-/* Temporary data storage arrays */
+/* Temporary data storage arrays; vectors are served from power-of-two size classes,
+   carved from shared chunks (or allocated singly when large) and recycled through
+   a free list per size class */
+#define MEMPOOL_MINCLASS        6  /* The smallest size class holds 2^6 bytes, so that all
+                                      classes are multiples of DEF_MEMORYALIGN */
+#define MEMPOOL_CLASSES        25  /* Number of size classes, up to 2^30 bytes; larger
+                                      vectors are allocated at their exact size */
+#define MEMPOOL_CHUNKSIZE   65536  /* Bytes per chunk; larger vectors than a quarter of this
+                                      are allocated singly */
+
+typedef struct _memblockrec
+{
+  struct    _memblockrec *next;    /* Next free block of the same size class */
+  struct    _memblockrec *chain;   /* Next singly allocated block, for the final release */
+  size_t    size;                  /* Usable bytes in the block */
+  int       sizeclass;             /* MEMPOOL_CLASSES for an oversize block */
+  MYBOOL    inuse;
+} memblockrec;
+
 typedef struct _workarraysrec
 {
   lprec     *lp;
-  int       size;
-  int       count;
-  char      **vectorarray;
-  int       *vectorsize;
+  memblockrec *freelist[MEMPOOL_CLASSES];
+  memblockrec *largelist;          /* Chain of singly allocated blocks */
+  char      *chunk;                /* Current chunk; each chunk links to the previous one */
+  int       chunkused;             /* Bytes carved from the current chunk */
+  COUNTER   obtained;              /* Number of vectors handed out */
+  COUNTER   bytesinuse, bytespeak, bytesreserved;
 } workarraysrec;
 
 typedef struct _LLrec
@@ -48,10 +68,16 @@ extern "C" {
 #endif
 
 /* Put function headers here */
+STATIC void *allocPOLICY(lprec *lp, void *ptr, size_t size, MYBOOL clear);
 STATIC MYBOOL allocCHAR(lprec *lp, char **ptr, int size, MYBOOL clear);
 STATIC MYBOOL allocMYBOOL(lprec *lp, MYBOOL **ptr, int size, MYBOOL clear);
-STATIC MYBOOL allocINT(lprec *lp, int **ptr, int size, MYBOOL clear);
-STATIC MYBOOL allocREAL(lprec *lp, REAL **ptr, int size, MYBOOL clear);
+STATIC MYBOOL allocINT(lprec *lp, int **ptr, NZINDEX size, MYBOOL clear);
+STATIC MYBOOL allocREAL(lprec *lp, REAL **ptr, NZINDEX size, MYBOOL clear);
+#ifdef NZINDEX64
+STATIC MYBOOL allocNZINDEX(lprec *lp, NZINDEX **ptr, NZINDEX size, MYBOOL clear);
+#else
+#define allocNZINDEX allocINT
+#endif
 STATIC MYBOOL allocLREAL(lprec *lp, LREAL **ptr, int size, MYBOOL clear);
 STATIC MYBOOL allocFREE(lprec *lp, void **ptr);
 REAL *cloneREAL(lprec *lp, REAL *origlist, int size);
@@ -14,6 +14,9 @@
 #ifdef WIN32
 # include <io.h>       /* Used in file search functions */
 #endif
+#if defined __linux__
+# include <sys/mman.h> /* Used for huge page advice */
+#endif
 #include <ctype.h>
 #include <string.h>
 #include <float.h>
@@ -812,6 +815,52 @@ REAL sortREALByINT(REAL *item, int *weight, int size, int offset, MYBOOL unique)
 }
 
 
+/* Memory functions */
+void *realloc_aligned(void *ptr, size_t newsize, size_t alignment, size_t hugesize)
+/* Reallocates the block to newsize bytes aligned to the given power of two in such
+   a way that free() can still release it; the previous contents are kept up to the
+   new size.  Blocks of at least hugesize bytes are aligned to HUGEPAGE_SIZE and,
+   where supported, advised for transparent huge pages.  Platforms without
+   posix_memalign fall back to realloc.  Returns NULL on failure, which leaves the
+   original block allocated. */
+{
+#if (defined WIN32) || (defined WIN64) || (defined NOALIGNEDALLOC)
+  return( realloc(ptr, newsize) );
+#else
+  void *newptr;
+
+  if(newsize == 0)
+    return( realloc(ptr, newsize) );
+  if((hugesize > 0) && (newsize >= hugesize) && (alignment < HUGEPAGE_SIZE))
+    alignment = HUGEPAGE_SIZE;
+
+  /* Let realloc do the work when the block can stay where it is or happens to
+     come out aligned; else copy it over to an aligned block */
+  if(ptr != NULL) {
+    ptr = realloc(ptr, newsize);
+    if(ptr == NULL)
+      return( ptr );
+    if(((size_t) ptr) % alignment == 0)
+      newptr = ptr;
+    else if(posix_memalign(&newptr, alignment, newsize) != 0)
+      return( ptr );
+    else {
+      memcpy(newptr, ptr, newsize);
+      free(ptr);
+    }
+  }
+  else if(posix_memalign(&newptr, alignment, newsize) != 0)
+    return( NULL );
+
+#if (defined __linux__) && (defined MADV_HUGEPAGE)
+  if((hugesize > 0) && (newsize >= hugesize) && (((size_t) newptr) % HUGEPAGE_SIZE == 0))
+    madvise(newptr, newsize / HUGEPAGE_SIZE * HUGEPAGE_SIZE, MADV_HUGEPAGE);
+#endif
+  return( newptr );
+#endif
+}
+
+
 /* Time and message functions */
 double timeNow(void)
 {
@@ -873,6 +922,27 @@ void blockWriteINT(FILE *output, char *label, int *myvector, int first, int last
     fprintf(output, "\n");
 }
 
+#ifdef NZINDEX64
+/* List a vector of non-zero positions for the given index range */
+void blockWriteNZINDEX(FILE *output, char *label, NZINDEX *myvector, int first, int last)
+{
+  int i, k = 0;
+
+  fprintf(output, "%s", label);
+  fprintf(output, "\n");
+  for(i = first; i <= last; i++) {
+    fprintf(output, " %5.0f", (double) myvector[i]);
+    k++;
+    if(k % 12 == 0) {
+      fprintf(output, "\n");
+      k = 0;
+    }
+  }
+  if(k % 12 != 0)
+    fprintf(output, "\n");
+}
+#endif
+
 /* List a vector of MYBOOL values for the given index range */
 void blockWriteBOOL(FILE *output, char *label, MYBOOL *myvector, int first, int last, MYBOOL asRaw)
 {
@@ -20,6 +20,10 @@
   #define LINEARSEARCH 5
 #endif
 
+#ifndef HUGEPAGE_SIZE
+  #define HUGEPAGE_SIZE  2097152
+#endif
+
 #if 0
   #define INTEGERTIME
 #endif
@@ -53,6 +57,14 @@
   #endif
 #endif
 
+#ifndef NZINDEX
+  #ifdef NZINDEX64
+    #define NZINDEX LLONG       /* 64-bit non-zero positions for over 2^31 elements */
+  #else
+    #define NZINDEX int         /* Position type of non-zeros in sparse matrix storage */
+  #endif
+#endif
+
 #ifndef MYBOOL
   #if 0
     #define MYBOOL unsigned int
@@ -69,7 +81,9 @@
 #endif
 
 #ifndef REALXP
-  #if 1
+  #if defined REALXP_COMPENSATED
+    #define REALXP REAL          /* Compensated accumulation in default precision */
+  #elif 1
     #define REALXP long double  /* Set local accumulation variable as long double */
   #else
     #define REALXP REAL          /* Set local accumulation as default precision */
@@ -194,7 +208,7 @@
 #define IF(t, x, y)       ((t) ? (x) : (y))
 #define SIGN(x)           ((x) < 0 ? -1 : 1)
 
-#define DELTA_SIZE(newSize, oldSize) ((int) ((newSize) * MIN(1.33, pow(1.5, fabs((double)newSize)/((oldSize+newSize)+1)))))
+#define DELTA_SIZE(newSize, oldSize) ((NZINDEX) ((newSize) * MIN(1.33, pow(1.5, fabs((double)newSize)/((oldSize+newSize)+1)))))
 
 #ifndef CMP_CALLMODEL
 #if (defined WIN32) || (defined WIN64)
@@ -310,10 +324,17 @@ int sortByREAL(int *item, REAL *weight, int size, int offset, MYBOOL unique);
 int sortByINT(int *item, int *weight, int size, int offset, MYBOOL unique);
 REAL sortREALByINT(REAL *item, int *weight, int size, int offset, MYBOOL unique);
 
+void *realloc_aligned(void *ptr, size_t newsize, size_t alignment, size_t hugesize);
+
 double timeNow(void);
 
 void blockWriteBOOL(FILE *output, char *label, MYBOOL *myvector, int first, int last, MYBOOL asRaw);
 void blockWriteINT(FILE *output, char *label, int *myvector, int first, int last);
+#ifdef NZINDEX64
+void blockWriteNZINDEX(FILE *output, char *label, NZINDEX *myvector, int first, int last);
+#else
+  #define blockWriteNZINDEX blockWriteINT
+#endif
 void blockWriteREAL(FILE *output, char *label, REAL *myvector, int first, int last);
 
 void printvec( int n, REAL *x, int modulo );